@@ -0,0 +1,96 @@
+#ifndef AI_PLAYER_H
+#define AI_PLAYER_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard_othellier.h"
+#include "endgame.h"
+#include "opening_book.h"
+#include "player.h"
+#include "search.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_AI_TIME_BUDGET_MS   1000
+#define DEFAULT_AI_THREADS          0       // One search thread per core
+#define AI_REPORT_LINES             2       // Lines of the report of a move, each one fits in 80 columns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Bot player : same contract as Player, but the position is chosen by a search instead of being asked on the terminal
+// Near the end of the game, the search is replaced by the endgame solver, which plays perfectly, and at the start by the opening book when it has the position
+// With pondering, the bot keeps searching on the time of its opponent : the position after the reply it expects is searched on a background thread
+// If the opponent plays it (ponder hit), that search goes on with the time budget of the move, otherwise it is stopped - its positions stay in the hash table
+class AI_Player : public Player
+{
+    public:
+        explicit AI_Player(const E_Pawn_Color color, std::shared_ptr<Board_Engine> othellier, const unsigned int time_budget_ms = DEFAULT_AI_TIME_BUDGET_MS, const unsigned int number_of_threads = DEFAULT_AI_THREADS, const std::size_t hash_size_mb = DEFAULT_HASH_SIZE_MB, const bool display_search = true);
+        ~AI_Player();
+
+        std::tuple<bool, E_Game_Command, unsigned int, unsigned int> Try_Place_Pawn(void) noexcept override;
+        void Pass_Turn(void) noexcept override;     // Both stop the pondering search : the move it waits for won't come
+        void End_Game(void) noexcept override;
+        const S_Search_Result & Get_Last_Search_Result(void) const noexcept;
+        const std::string & Get_Last_Report(void) const noexcept;     // Search, endgame solver or book result of the last move, lines separated by '\n'
+
+        // Settings for the matches between bots : a fixed depth and a clean start make the games reproducible
+        void Set_Max_Depth(const unsigned int max_depth) noexcept;
+        void Set_Endgame_Empties(const unsigned int endgame_empties) noexcept;
+        void New_Game(void) noexcept;
+
+        // Book read before any search, shared by every bot which uses the same file (nullptr : no book)
+        void Set_Opening_Book(std::shared_ptr<const Opening_Book> opening_book) noexcept;
+
+        // Pattern weights of the search evaluation, shared like the book (nullptr : slot values and mobility)
+        void Set_Evaluation_Weights(std::shared_ptr<const Pattern_Weights> evaluation_weights) noexcept;
+
+        // Off by default : the search threads of a pondering bot compete with its opponent for the cores (matches between bots on one machine)
+        void Set_Pondering(const bool pondering) noexcept;
+
+    protected:
+        void Start_Pondering(void) noexcept;
+        bool Finish_Pondering(void) noexcept;   // True on a ponder hit, the search result is then the one of the pondering
+
+        // Reports are always written, and only displayed with display search : the game draws the report in its frame instead
+        void Report_Search_Result(void) noexcept;
+        void Report_Endgame_Result(const S_Endgame_Result & endgame_result) noexcept;
+        void Report_Book_Result(void) noexcept;
+
+    protected:
+        unsigned int _time_budget_ms;
+        unsigned int _max_depth;
+        unsigned int _endgame_empties;      // The endgame solver is used once there are no more free slots than this
+        bool _display_search;
+        Search_Engine _search_engine;
+        Endgame_Solver _endgame_solver;
+        std::shared_ptr<const Opening_Book> _opening_book;
+        S_Search_Result _last_search_result;
+        std::string _last_report;
+
+        // Pondering
+        bool _pondering;
+        bool _ponder_hit;                       // The last move comes from a ponder hit
+        std::thread _ponder_thread;
+        std::mutex _ponder_mutex;
+        bool _ponder_done;                      // Protected by the ponder mutex : the search of the pondering thread has returned
+        Bitboard_Othellier _ponder_othellier;   // Position searched : the position after the reply expected, the bot to play
+        S_Search_Result _ponder_result;
+};
+
+#endif // AI_PLAYER_H
@@ -0,0 +1,20 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "configuration.h"
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Number of calls to the global operator new since the start of the program
+// Only counted when COUNT_ALLOCATIONS is defined in configuration.h, always 0 otherwise
+unsigned long long Get_Number_of_Allocations(void) noexcept;
+
+#endif // ALLOCATION_COUNTER_H
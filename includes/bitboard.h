@@ -0,0 +1,140 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Layout : bit (row * 8 + column), row and column starting at 0 -> bit 0 is the top left slot (X = 1, Y = 1) and bit 63 is the bottom right slot (X = 8, Y = 8)
+#define NUMBER_SQUARES  64
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Bitboard Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+namespace Bitboard
+{
+    constexpr uint64_t ALL_SQUARES{0xFFFFFFFFFFFFFFFFULL};
+    constexpr uint64_t NOT_A_FILE {0xFEFEFEFEFEFEFEFEULL}; // Everything except the column X = 1
+    constexpr uint64_t NOT_H_FILE {0x7F7F7F7F7F7F7F7FULL}; // Everything except the column X = 8
+
+    // ------------------------------------------------------------------------------------------------------------------------------------------------
+
+    inline unsigned int Count_Bits(const uint64_t bitboard) noexcept
+    {
+#if defined(_MSC_VER)
+        return static_cast<unsigned int>(__popcnt64(bitboard));
+#else
+        return static_cast<unsigned int>(__builtin_popcountll(bitboard));
+#endif
+    } // Count_Bits
+
+    // Index of the lowest bit set - the bitboard must not be empty
+    inline unsigned int First_Square(const uint64_t bitboard) noexcept
+    {
+#if defined(_MSC_VER)
+        unsigned long index{0};
+        _BitScanForward64(&index, bitboard);
+        return static_cast<unsigned int>(index);
+#else
+        return static_cast<unsigned int>(__builtin_ctzll(bitboard));
+#endif
+    } // First_Square
+
+    constexpr uint64_t Square_Bit(const unsigned int square) noexcept
+    {
+        return 1ULL << square;
+    } // Square_Bit
+
+    // Position X and Y are the ones used by the players, from 1 to 8
+    constexpr unsigned int Square_of(const unsigned int position_x, const unsigned int position_y) noexcept
+    {
+        return (position_y - 1) * 8 + (position_x - 1);
+    } // Square_of
+
+    // ------------------------------------------------------------------------------------------------------------------------------------------------
+
+    // Positive SHIFT moves the pawns toward the bottom right, negative SHIFT toward the top left
+    // MASK removes what wrapped from one side of the othellier to the other
+    template<int SHIFT, uint64_t MASK>
+    constexpr uint64_t Shift(const uint64_t bitboard) noexcept
+    {
+        return (SHIFT > 0 ? bitboard << (SHIFT > 0 ? SHIFT : 0) : bitboard >> (SHIFT < 0 ? -SHIFT : 0)) & MASK;
+    } // Shift
+
+    // Kogge-Stone occluded fill : propagates the generator through the propagator in the direction, in 3 steps instead of 7
+    template<int SHIFT, uint64_t MASK>
+    inline uint64_t Fill(uint64_t generator, uint64_t propagator) noexcept
+    {
+        propagator &= MASK;
+        generator  |= propagator & Shift<SHIFT,     ALL_SQUARES>(generator);
+        propagator &=              Shift<SHIFT,     ALL_SQUARES>(propagator);
+        generator  |= propagator & Shift<SHIFT * 2, ALL_SQUARES>(generator);
+        propagator &=              Shift<SHIFT * 2, ALL_SQUARES>(propagator);
+        generator  |= propagator & Shift<SHIFT * 4, ALL_SQUARES>(generator);
+        return generator;
+    } // Fill
+
+    // Empty slots where a pawn closes at least one line of opponent pawns in this direction
+    template<int SHIFT, uint64_t MASK>
+    inline uint64_t Moves_in_Direction(const uint64_t player, const uint64_t opponent, const uint64_t empty) noexcept
+    {
+        const uint64_t opponent_lines{Fill<SHIFT, MASK>(Shift<SHIFT, MASK>(player) & opponent, opponent)};
+        return Shift<SHIFT, MASK>(opponent_lines) & empty;
+    } // Moves_in_Direction
+
+    // Opponent pawns switched in this direction by a pawn placed on move
+    template<int SHIFT, uint64_t MASK>
+    inline uint64_t Flips_in_Direction(const uint64_t move, const uint64_t player, const uint64_t opponent) noexcept
+    {
+        const uint64_t opponent_line{Fill<SHIFT, MASK>(Shift<SHIFT, MASK>(move) & opponent, opponent)};
+        return (Shift<SHIFT, MASK>(opponent_line) & player) ? opponent_line : 0;
+    } // Flips_in_Direction
+
+    // ------------------------------------------------------------------------------------------------------------------------------------------------
+
+    // Every slot where the player can place a pawn
+    inline uint64_t Get_Legal_Moves(const uint64_t player, const uint64_t opponent) noexcept
+    {
+        const uint64_t empty{~(player | opponent)};
+
+        return Moves_in_Direction<-8, ALL_SQUARES>(player, opponent, empty)   // Up
+             | Moves_in_Direction< 8, ALL_SQUARES>(player, opponent, empty)   // Down
+             | Moves_in_Direction<-1, NOT_H_FILE >(player, opponent, empty)   // Left
+             | Moves_in_Direction< 1, NOT_A_FILE >(player, opponent, empty)   // Right
+             | Moves_in_Direction<-9, NOT_H_FILE >(player, opponent, empty)   // Up Left
+             | Moves_in_Direction<-7, NOT_A_FILE >(player, opponent, empty)   // Up Right
+             | Moves_in_Direction< 7, NOT_H_FILE >(player, opponent, empty)   // Down Left
+             | Moves_in_Direction< 9, NOT_A_FILE >(player, opponent, empty);  // Down Right
+    } // Get_Legal_Moves
+
+    // Every opponent pawn switched when the player places a pawn on the square (0 if the move is not legal)
+    inline uint64_t Get_Flips(const unsigned int square, const uint64_t player, const uint64_t opponent) noexcept
+    {
+        const uint64_t move{Square_Bit(square)};
+
+        return Flips_in_Direction<-8, ALL_SQUARES>(move, player, opponent)    // Up
+             | Flips_in_Direction< 8, ALL_SQUARES>(move, player, opponent)    // Down
+             | Flips_in_Direction<-1, NOT_H_FILE >(move, player, opponent)    // Left
+             | Flips_in_Direction< 1, NOT_A_FILE >(move, player, opponent)    // Right
+             | Flips_in_Direction<-9, NOT_H_FILE >(move, player, opponent)    // Up Left
+             | Flips_in_Direction<-7, NOT_A_FILE >(move, player, opponent)    // Up Right
+             | Flips_in_Direction< 7, NOT_H_FILE >(move, player, opponent)    // Down Left
+             | Flips_in_Direction< 9, NOT_A_FILE >(move, player, opponent);   // Down Right
+    } // Get_Flips
+} // namespace Bitboard
+
+#endif // BITBOARD_H
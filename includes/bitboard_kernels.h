@@ -0,0 +1,91 @@
+#ifndef BITBOARD_KERNELS_H
+#define BITBOARD_KERNELS_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define X86_64_KERNELS
+#include <immintrin.h>
+#endif
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// GCC and Clang only generate the instructions of a function compiled for a target : the rest of the program stays runnable on any x86-64 processor
+// MSVC always accepts the intrinsics, the CPUID test is enough
+// The vector functions must only be called once Detect_Kernel_Type returned their type (or a faster one)
+#if defined(X86_64_KERNELS) && (defined(__GNUC__) || defined(__clang__))
+#define TARGET_AVX2     __attribute__((target("avx2,popcnt")))
+#define TARGET_AVX512   __attribute__((target("avx512f,avx512vl,popcnt")))
+#else
+#define TARGET_AVX2
+#define TARGET_AVX512
+#endif
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Enum Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Instruction sets the legal moves and the flips are computed with, from the slowest to the fastest
+enum class E_Kernel_Type : int
+{
+    SCALAR  = 0,    // Eight directions one after the other, on any processor
+    AVX2    = 1,    // Four directions per 256 bits register, both ways one after the other
+    AVX512  = 2     // Eight directions in one 512 bits register
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+struct S_Bitboard_Kernels
+{
+    E_Kernel_Type   type;
+    uint64_t        (*get_legal_moves)(const uint64_t player, const uint64_t opponent);
+    uint64_t        (*get_flips)(const unsigned int square, const uint64_t player, const uint64_t opponent);
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Bitboard Kernels Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// One binary runs on every x86-64 processor : the kernels are chosen once at startup from what the processor (and the OS) supports
+// Until then, and on the other architectures, the scalar functions of bitboard.h are used
+namespace Bitboard
+{
+    extern S_Bitboard_Kernels kernels;
+
+    // Fastest kernels supported by the processor running the program
+    E_Kernel_Type Detect_Kernel_Type(void) noexcept;
+
+    // Returns false (and keeps the current kernels) if the processor doesn't support the type asked
+    bool Select_Kernels(const E_Kernel_Type type) noexcept;
+
+    const char * Get_Kernel_Name(const E_Kernel_Type type) noexcept;
+
+    // ------------------------------------------------------------------------------------------------------------------------------------------------
+
+    inline uint64_t Fast_Legal_Moves(const uint64_t player, const uint64_t opponent) noexcept
+    {
+        return kernels.get_legal_moves(player, opponent);
+    } // Fast_Legal_Moves
+
+    inline uint64_t Fast_Flips(const unsigned int square, const uint64_t player, const uint64_t opponent) noexcept
+    {
+        return kernels.get_flips(square, player, opponent);
+    } // Fast_Flips
+} // namespace Bitboard
+
+#endif // BITBOARD_KERNELS_H
@@ -0,0 +1,81 @@
+#ifndef BITBOARD_OTHELLIER_H
+#define BITBOARD_OTHELLIER_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "board_engine.h"
+#include "configuration.h"
+#include "pawn.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// A game can't last more than one move per empty slot of the starting position (a pass doesn't change the othellier so it is never stacked)
+#define MAX_PLIES   (MAX_PAWNS - 4)
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Everything needed to undo a move : the pawns switched, the slot where the pawn was placed and the hash key before the move
+struct S_Move_Undo
+{
+    uint64_t        flips;
+    uint64_t        hash_key;
+    unsigned char   square;
+    E_Pawn_Color    color;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Othellier stored as two 64 bits boards (one bit per slot and per color), see bitboard.h for the layout
+class Bitboard_Othellier : public Board_Engine
+{
+    public:
+        Bitboard_Othellier();
+        ~Bitboard_Othellier();
+
+        bool Place_Pawn(const unsigned int position_x, const unsigned int position_y, Pawn pawn) noexcept override;
+        bool Can_Play(const Pawn & pawn) const noexcept override;
+        uint64_t Generate_Legal_Moves(const E_Pawn_Color color) const noexcept override;
+        void Reset_Othellier(void) noexcept override;
+        void Draw_Othellier(void) const noexcept override;
+        std::pair<unsigned int, unsigned int> Count_Pawns(void) const noexcept override;
+        std::pair<unsigned int, unsigned int> Count_All_Pawns(void) const noexcept override;
+        unsigned int Get_Number_of_Occupied_Slots(void) const noexcept override;
+        unsigned int Get_Number_of_Free_Slots(void) const noexcept override;
+
+        uint64_t Get_Pawns(const E_Pawn_Color color) const noexcept override;
+        uint64_t Get_Opponent_Pawns(const E_Pawn_Color color) const noexcept;
+
+        // Search interface : the move must be legal (see Generate_Legal_Moves), Unmake_Move undoes the last move made
+        void Set_Othellier(const uint64_t black_pawns, const uint64_t white_pawns) noexcept;
+        const S_Move_Undo & Make_Move(const unsigned int square, const E_Pawn_Color color) noexcept;
+        void Unmake_Move(void) noexcept;
+        unsigned int Get_Number_of_Moves_Made(void) const noexcept;
+        uint64_t Get_Hash_Key(void) const noexcept; // Zobrist key of the pawns (see zobrist.h), the side to play is not included
+
+    protected:
+        uint64_t _black_pawns;
+        uint64_t _white_pawns;
+        uint64_t _hash_key;     // Updated by every move
+
+        // Undo stack, preallocated for a whole game
+        std::array<S_Move_Undo, MAX_PLIES> _undo_stack;
+        unsigned int _number_of_moves_made;
+};
+
+#endif /* BITBOARD_OTHELLIER_H */
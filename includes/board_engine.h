@@ -0,0 +1,38 @@
+#ifndef BOARD_ENGINE_H
+#define BOARD_ENGINE_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "pawn.h"
+
+#include <cstdint>
+#include <utility>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Public surface shared by every board implementation (the Slot based Othellier and the Bitboard_Othellier)
+// The Player class and the game loop only use this interface, so the engine can be switched where the board is created
+class Board_Engine
+{
+    public:
+        virtual ~Board_Engine() = default;
+
+        virtual bool Place_Pawn(const unsigned int position_x, const unsigned int position_y, Pawn pawn) noexcept = 0;
+        virtual bool Can_Play(const Pawn & pawn) const noexcept = 0;
+        virtual uint64_t Generate_Legal_Moves(const E_Pawn_Color color) const noexcept = 0; // One bit per slot where the color can place a pawn (layout of bitboard.h)
+        virtual uint64_t Get_Pawns(const E_Pawn_Color color) const noexcept = 0;             // One bit per slot occupied by the color (layout of bitboard.h)
+        virtual void Reset_Othellier(void) noexcept = 0;
+        virtual void Draw_Othellier(void) const noexcept = 0;
+        virtual std::pair<unsigned int, unsigned int> Count_Pawns(void) const noexcept = 0;
+        virtual std::pair<unsigned int, unsigned int> Count_All_Pawns(void) const noexcept = 0;
+        virtual unsigned int Get_Number_of_Occupied_Slots(void) const noexcept = 0;
+        virtual unsigned int Get_Number_of_Free_Slots(void) const noexcept = 0;
+};
+
+#endif /* BOARD_ENGINE_H */
@@ -20,4 +20,7 @@
 // Game Configuration
 #define MAX_PAWNS       64
 
+// Debug Configuration
+//#define COUNT_ALLOCATIONS // Counts the heap allocations, see allocation_counter.h (used by Test_Game_Logic in main.cpp)
+
 #endif // CONFIGURATION_H
@@ -0,0 +1,85 @@
+#ifndef ENDGAME_H
+#define ENDGAME_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "board_engine.h"
+#include "pawn.h"
+#include "transposition_table.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define ENDGAME_SOLVER_EMPTIES      20      // The AI bot solves the game exactly once there are no more free slots than this
+#define ENDGAME_HASH_SIZE_MB        16
+#define ENDGAME_SHALLOW_EMPTIES     6       // Under this, the moves are only ordered by parity : sorting them costs more than it saves
+#define ENDGAME_HASH_MIN_EMPTIES    9       // Under this, the hash table costs more than it saves
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+struct S_Endgame_Move
+{
+    unsigned int    square;
+    uint64_t        flips;
+    unsigned int    priority;   // The lowest is searched first
+};
+
+struct S_Endgame_Result
+{
+    unsigned int        best_move;      // Square of the move (bitboard.h layout), NO_MOVE if the color can't play
+    int                 score;          // Final pawns difference with perfect play, from the point of view of the color solved (empty slots go to the winner)
+    unsigned int        empties;
+    unsigned long long  nodes;
+    unsigned long long  elapsed_ms;
+    unsigned long long  nodes_per_second;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Exact solver for the end of the game : the whole tree is searched, the score is the final pawns difference
+// Deep nodes order their moves by the mobility left to the opponent (fastest first), use the hash table and the stable pawns to cut the search
+// The last empty slots are searched by dedicated functions, ordered by parity (moves in regions with an odd number of empty slots first)
+class Endgame_Solver
+{
+    public:
+        explicit Endgame_Solver(const std::size_t hash_size_mb = ENDGAME_HASH_SIZE_MB);
+        ~Endgame_Solver();
+
+        Endgame_Solver(const Endgame_Solver &) = delete;
+        Endgame_Solver & operator=(const Endgame_Solver &) = delete;
+
+        S_Endgame_Result Solve(const Board_Engine & othellier, const E_Pawn_Color color) noexcept;
+        S_Endgame_Result Solve(const uint64_t player, const uint64_t opponent) noexcept;
+        void Clear_Hash(void) noexcept;
+
+    protected:
+        int Solve_Deep(const uint64_t player, const uint64_t opponent, int alpha, const int beta, const unsigned int empties, const bool opponent_passed) noexcept;
+        int Solve_Shallow(const uint64_t player, const uint64_t opponent, int alpha, const int beta, const unsigned int empties, const bool opponent_passed) noexcept;
+        int Solve_3(const uint64_t player, const uint64_t opponent, int alpha, const int beta, const unsigned int square_1, const unsigned int square_2, const unsigned int square_3, const bool opponent_passed) noexcept;
+        int Solve_2(const uint64_t player, const uint64_t opponent, int alpha, const int beta, const unsigned int square_1, const unsigned int square_2, const bool opponent_passed) noexcept;
+        int Solve_1(const uint64_t player, const uint64_t opponent, const unsigned int square) noexcept;
+        unsigned int Sort_Moves(const uint64_t player, const uint64_t opponent, uint64_t moves, const unsigned int hash_move, std::array<S_Endgame_Move, NUMBER_SQUARES> & ordered_moves) const noexcept;
+        int Solve_Child(const uint64_t player, const uint64_t opponent, const int alpha, const int beta, const unsigned int empties) noexcept;
+
+    protected:
+        Transposition_Table _transposition_table;
+        unsigned long long _nodes;
+};
+
+#endif // ENDGAME_H
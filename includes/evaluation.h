@@ -0,0 +1,128 @@
+#ifndef EVALUATION_H
+#define EVALUATION_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_othellier.h"
+#include "pawn.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// A pattern is a set of slots, its index is the content of its slots in base 3 (0 : empty, 1 : black, 2 : white)
+// Each pattern is used with its symmetries (features) : the 4 edges, the 4 corners... share the same weights, so the slots of each feature follow the same order
+#define NUMBER_PATTERNS             11
+#define NUMBER_PATTERN_FEATURES     46
+#define MAX_PATTERN_SQUARES         10
+#define MAX_SQUARE_FEATURES         10      // Features which contain the same slot
+
+// One set of weights per phase of the game, from the number of pawns
+#define NUMBER_PATTERN_PHASES       12
+#define PAWNS_PER_PATTERN_PHASE     5
+
+// Weights file : header, then the weights of each phase (int16, little endian)
+#define PATTERN_WEIGHTS_VERSION     1
+#define WEIGHTS_FILE_HEADER_SIZE    16      // Magic (4 bytes), version (1 byte), reserved (3 bytes), number of phases (4 bytes), weights per phase (4 bytes)
+#define DEFAULT_WEIGHTS_FILE        "othello.weights"
+
+#define PATTERN_WEIGHT_SCALE        64      // Weights are in 1/64 pawn of final difference, from the point of view of black
+#define PATTERN_PAWN_SCORE          10      // Search score of one pawn of difference predicted by the patterns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Enum Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+enum class E_Pattern : int
+{
+    EDGE_2X     = 0,    // Edge and both X slots (diagonal neighbours of the corners)
+    CORNER_3X3  = 1,
+    CORNER_2X5  = 2,
+    DIAGONAL_8  = 3,
+    DIAGONAL_7  = 4,
+    DIAGONAL_6  = 5,
+    DIAGONAL_5  = 6,
+    DIAGONAL_4  = 7,
+    LINE_2      = 8,    // Second row from the edge
+    LINE_3      = 9,
+    LINE_4      = 10
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Weights of every pattern and every phase, loaded from a weights file : read only once loaded, shared by every search thread
+class Pattern_Weights
+{
+    public:
+        Pattern_Weights();
+        ~Pattern_Weights();
+
+        bool Load(const std::string & path) noexcept;   // False if the file is not a weights file of these patterns
+        bool Save(const std::string & path) const noexcept;
+        void Clear(void) noexcept;                      // Every weight to 0
+
+        int16_t * Get_Data(void) noexcept;              // Weight of (phase, feature, index) at Get_Weight_Offset(phase, feature) + index
+        const int16_t * Get_Data(void) const noexcept;
+        std::size_t Get_Size(void) const noexcept;
+
+    protected:
+        std::vector<int16_t> _weights;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Pattern indices of a position, updated by each move instead of being computed again : an evaluation is one lookup per feature
+// The search makes the same moves on its othellier and here, Unmake_Move goes back to the indices before the last move
+class Pattern_Evaluator
+{
+    public:
+        Pattern_Evaluator();
+        ~Pattern_Evaluator();
+
+        void Set_Position(const uint64_t black_pawns, const uint64_t white_pawns) noexcept;
+        void Make_Move(const unsigned int square, const uint64_t flips, const E_Pawn_Color color) noexcept;
+        void Unmake_Move(void) noexcept;
+
+        const uint16_t * Get_Indices(void) const noexcept;
+
+        // Search score for the color, from the pawns on the othellier
+        int Evaluate(const Pattern_Weights & weights, const E_Pawn_Color color, const unsigned int number_of_pawns) const noexcept;
+
+    protected:
+        std::array<std::array<uint16_t, NUMBER_PATTERN_FEATURES>, MAX_PLIES + 1> _indices;     // One copy per move made, the last one is the position
+        unsigned int _ply;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Evaluation Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Indices of every feature, computed from the pawns (NUMBER_PATTERN_FEATURES values)
+void Compute_Pattern_Indices(const uint64_t black_pawns, const uint64_t white_pawns, uint16_t * indices) noexcept;
+
+unsigned int Get_Pattern_Phase(const unsigned int number_of_pawns) noexcept;
+E_Pattern Get_Feature_Pattern(const unsigned int feature) noexcept;
+std::size_t Get_Weight_Offset(const unsigned int phase, const unsigned int feature) noexcept;
+std::size_t Get_Weights_per_Phase(void) noexcept;
+
+// Sum of the weights of the features, in 1/PATTERN_WEIGHT_SCALE pawn for black
+int Sum_Pattern_Weights(const Pattern_Weights & weights, const uint16_t * indices, const unsigned int phase) noexcept;
+
+#endif // EVALUATION_H
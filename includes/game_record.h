@@ -0,0 +1,137 @@
+#ifndef GAME_RECORD_H
+#define GAME_RECORD_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "enum_game.h"
+#include "mapped_file.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Archive : file header, then the games one after the other, each one a record header followed by its moves (one byte each)
+// Index (archive path + GAME_INDEX_EXTENSION) : file header, then the offset of each game in the archive (8 bytes each), so game N is found in O(1)
+// Every number is little endian, whatever the processor which wrote it
+#define GAME_RECORD_VERSION         1
+#define GAME_FILE_HEADER_SIZE       8       // Magic (4 bytes), version (1 byte), reserved (3 bytes)
+#define GAME_RECORD_HEADER_SIZE     16      // Timestamp (8), player 1 (2), player 2 (2), result (1), black pawns (1), white pawns (1), number of moves (1)
+#define GAME_INDEX_ENTRY_SIZE       8
+#define GAME_INDEX_EXTENSION        ".idx"
+#define PASS_MOVE                   NUMBER_SQUARES  // Move byte of a pass, the other moves are squares (bitboard.h layout)
+#define MAX_RECORDED_MOVES          255
+#define DEFAULT_GAME_ARCHIVE_FILE   "othello.games"     // Archive of the games played in the terminal, next to the executable
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Game filled by the game loop, then appended to the archive
+struct S_Game_Record
+{
+    uint64_t                                timestamp;      // Seconds since 1970, when the game ended
+    uint16_t                                player_1;       // Identifiers chosen by the writer (engine version, account...) : player 1 plays black
+    uint16_t                                player_2;
+    E_Game_Result                           result;
+    std::pair<unsigned int, unsigned int>   pawns;          // Count_All_Pawns at the end : black, white
+    std::vector<uint8_t>                    moves;          // Squares from the first move, PASS_MOVE for a pass
+};
+
+// Game read in an archive : the header is decoded, the moves are read where they are in the mapped archive (valid until the reader is closed)
+struct S_Game_Record_View
+{
+    uint64_t                                timestamp;
+    uint16_t                                player_1;
+    uint16_t                                player_2;
+    E_Game_Result                           result;
+    std::pair<unsigned int, unsigned int>   pawns;
+    unsigned int                            number_of_moves;
+    const uint8_t *                         moves;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Append only writer : an existing archive is continued, the games already written are never touched
+// Each game is written in the archive, then its offset in the index : a crash can only lose the last game, Open rebuilds an index which is behind
+class Game_Record_Writer
+{
+    public:
+        Game_Record_Writer();
+        ~Game_Record_Writer();
+
+        Game_Record_Writer(const Game_Record_Writer &) = delete;
+        Game_Record_Writer & operator=(const Game_Record_Writer &) = delete;
+
+        bool Open(const std::string & path) noexcept;   // False if the file is not an archive, or if it ends with an incomplete game
+        void Close(void) noexcept;
+
+        bool Write_Game(const S_Game_Record & game) noexcept;
+        bool Flush(void) noexcept;
+
+        std::size_t Get_Number_of_Games(void) const noexcept;
+
+    protected:
+        std::FILE * _archive;
+        std::FILE * _index;
+        uint64_t _archive_size;
+        std::size_t _number_of_games;
+        std::vector<uint8_t> _buffer;   // Record being encoded, kept to avoid an allocation per game
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Reader of a whole archive mapped in memory : the games are read without any copy, by index in O(1) or one after the other
+// Without its index (or with an index behind the archive), the offsets are found with one scan of the archive at Open
+class Game_Record_Reader
+{
+    public:
+        Game_Record_Reader();
+        ~Game_Record_Reader();
+
+        Game_Record_Reader(const Game_Record_Reader &) = delete;
+        Game_Record_Reader & operator=(const Game_Record_Reader &) = delete;
+
+        bool Open(const std::string & path) noexcept;
+        void Close(void) noexcept;
+
+        std::size_t Get_Number_of_Games(void) const noexcept;
+        S_Game_Record_View Get_Game(const std::size_t game) const noexcept;
+        std::size_t Get_Game_Offset(const std::size_t game) const noexcept;     // Position of the game in the archive
+
+        // Sequential reading, without the index : offset starts at 0 and is moved to the next game, false after the last complete game
+        bool Next_Game(std::size_t & offset, S_Game_Record_View & game) const noexcept;
+
+    protected:
+        Mapped_File _archive;
+        Mapped_File _index;
+        bool _use_index;
+        std::vector<uint64_t> _offsets;     // Only when the index file can't be used
+        std::size_t _number_of_games;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Game Record Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Game of the record starting at data : false if the size left is too small for it
+bool Decode_Game_Record(const uint8_t * data, const std::size_t size, S_Game_Record_View & game) noexcept;
+
+#endif // GAME_RECORD_H
@@ -0,0 +1,222 @@
+#ifndef GAME_SERVER_H
+#define GAME_SERVER_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard_othellier.h"
+#include "pawn.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_SERVER_WORKERS      0       // One bot worker per core
+#define SERVER_BOT_HASH_SIZE_MB     16      // Hash table of each worker, shared by the games it plays
+#define SERVER_MAX_BOT_DEPTH        12      // Depth asked by the clients is capped : one move of a bot stays under a second
+#define SERVER_MAX_LINE_SIZE        256     // A connection which sends a longer line is closed
+#define SERVER_READ_SIZE            4096
+#define SERVER_MAX_EVENTS           256     // Events read by one epoll_wait
+
+// Latencies : 16 buckets for each power of two of nanoseconds, each bucket within 1/16 of its durations (from a few ns to minutes)
+#define LATENCY_SUB_BUCKET_BITS     4
+#define NUMBER_LATENCY_BUCKETS      ((64 - LATENCY_SUB_BUCKET_BITS + 1) << LATENCY_SUB_BUCKET_BITS)
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Enum Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+enum class E_Server_Game_Mode : int
+{
+    NO_GAME = 0,
+    HUMANS  = 1,    // The client plays both colors (two players on one client)
+    BOT     = 2,    // The client plays black, a bot of the server plays white
+    BOTS    = 3     // A bot of the server plays both colors, the client watches
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// tcp:<port>, tcp:<host>:<port> or unix:<path>
+struct S_Server_Address
+{
+    bool            unix_socket;
+    std::string     path;           // Unix socket
+    std::string     host;           // TCP : IPv4 address, 0.0.0.0 for the server by default, 127.0.0.1 for the clients
+    uint16_t        port;
+};
+
+struct S_Server_Statistics
+{
+    unsigned long long  connections;        // Open now
+    unsigned long long  matches;            // Played to the end (abandoned games are not counted)
+    unsigned long long  moves;              // Moves of the clients, validated
+    unsigned long long  bot_moves;
+    double              elapsed_s;
+    double              matches_per_second;
+    unsigned long long  validation_p50_ns;  // Parsing, checking and playing a move of a client
+    unsigned long long  validation_p99_ns;
+};
+
+// One game of a connection : the moves of the clients are checked here, the bots search in the worker pool
+struct S_Server_Game
+{
+    E_Server_Game_Mode  mode;
+    unsigned long long  game_id;
+    Bitboard_Othellier  othellier;
+    E_Pawn_Color        color;              // Color to play
+    unsigned int        bot_depth;
+    bool                waiting_bot;        // A worker searches the move, the client can't play
+};
+
+struct S_Server_Connection
+{
+    int                 descriptor;
+    uint64_t            connection_id;      // Never reused, unlike the descriptors : a bot move for a closed connection is dropped
+    std::string         input;              // Bytes received after the last complete line
+    std::string         output;             // Bytes not written yet (the socket was full)
+    bool                waiting_output;     // EPOLLOUT is watched
+    S_Server_Game       game;
+};
+
+struct S_Bot_Job
+{
+    uint64_t            connection_id;
+    unsigned long long  game_id;
+    uint64_t            black_pawns;
+    uint64_t            white_pawns;
+    E_Pawn_Color        color;
+    unsigned int        depth;
+    unsigned int        move;               // Result, from the worker
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Distribution of durations in a constant memory : the percentiles are exact to the size of a bucket (6 %)
+class Latency_Histogram
+{
+    public:
+        Latency_Histogram();
+        ~Latency_Histogram();
+
+        void Clear(void) noexcept;
+        void Add(const unsigned long long duration_ns) noexcept;
+
+        unsigned long long Get_Count(void) const noexcept;
+        unsigned long long Get_Percentile_ns(const double percentile) const noexcept;  // Upper bound of its bucket, percentile from 0 to 100
+
+    protected:
+        static unsigned int Get_Bucket(const unsigned long long duration_ns) noexcept;
+        static unsigned long long Get_Bucket_Limit(const unsigned int bucket) noexcept;
+
+    protected:
+        std::array<unsigned long long, NUMBER_LATENCY_BUCKETS> _buckets;
+        unsigned long long _count;
+        unsigned long long _max_ns;     // Bound of the percentiles in the bucket of the longest duration
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Many independent games in one process : one thread runs the epoll loop (connections, commands, checks of the moves), a pool of workers searches the bot moves
+// Line protocol, one command per line (see README, Game server) :
+//     client : NEW HUMANS | NEW BOT <depth> | NEW BOTS <depth>, MOVE <d3>, QUIT (abandon the game), STATS
+//     server : GAME <id>, TURN <B|W>, PLAYED <B|W> <d3>, PASS <B|W>, END <black pawns> <white pawns> | END QUIT, STATS ..., ERR <reason>
+// Linux only (epoll, eventfd) : elsewhere Listen fails
+class Game_Server
+{
+    public:
+        explicit Game_Server(const unsigned int number_of_workers = DEFAULT_SERVER_WORKERS);
+        ~Game_Server();
+
+        Game_Server(const Game_Server &) = delete;
+        Game_Server & operator=(const Game_Server &) = delete;
+
+        bool Listen(const S_Server_Address & address) noexcept;
+
+        // Serves until Stop, writes the statistics every report interval (0 : never) - in the calling thread
+        void Run(const unsigned int report_interval_s = 0) noexcept;
+        void Stop(void) noexcept;           // From any thread or a signal handler
+        S_Server_Statistics Get_Statistics(void) const noexcept;   // From the thread of Run, or once it has returned
+
+    protected:
+        void Accept_Connections(void) noexcept;
+        // False once the connection is closed : the connection is destroyed, it must not be used any more
+        bool Read_Connection(S_Server_Connection & connection) noexcept;
+        bool Write_Connection(S_Server_Connection & connection) noexcept;
+        void Close_Connection(const uint64_t connection_id) noexcept;
+
+        void Handle_Line(S_Server_Connection & connection, const std::string & line) noexcept;
+        void Handle_Move(S_Server_Connection & connection, const std::string & argument) noexcept;
+        void Next_Turn(S_Server_Connection & connection) noexcept;
+        void Handle_Bot_Moves(void) noexcept;
+        void Send(S_Server_Connection & connection, const std::string & text) noexcept;
+        std::string Format_Statistics(void) const noexcept;
+
+        void Worker_Loop(void) noexcept;
+        void Stop_Workers(void) noexcept;
+
+    protected:
+        // Event loop
+        int _listen_descriptor;
+        int _epoll_descriptor;
+        int _event_descriptor;              // Written by the workers (bot moves) and Stop
+        std::string _unix_path;             // Removed when the server is destroyed
+        std::atomic<bool> _quit;
+        std::unordered_map< uint64_t, std::unique_ptr<S_Server_Connection> > _connections;
+        uint64_t _next_connection_id;
+        unsigned long long _next_game_id;
+
+        // Statistics
+        std::chrono::steady_clock::time_point _start;
+        unsigned long long _matches;
+        unsigned long long _moves;
+        unsigned long long _bot_moves;
+        Latency_Histogram _validation_latencies;
+
+        // Worker pool
+        unsigned int _number_of_workers;
+        std::vector<std::thread> _workers;
+        std::mutex _jobs_mutex;
+        std::condition_variable _jobs_condition;
+        std::deque<S_Bot_Job> _jobs;        // Protected by the jobs mutex
+        std::vector<S_Bot_Job> _results;    // Protected by the jobs mutex
+        bool _stop_workers;                 // Protected by the jobs mutex
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Server Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+bool Parse_Server_Address(const std::string & text, const bool server, S_Server_Address & address) noexcept;
+int Connect_to_Server(const S_Server_Address & address) noexcept;      // Connected socket (blocking), -1 on error
+
+// Square of the bitboards as written by the protocol (d3), and back - NUMBER_SQUARES if the text is not a slot
+std::string Format_Square(const unsigned int square);
+unsigned int Parse_Square(const std::string & text) noexcept;
+
+#endif // GAME_SERVER_H
@@ -0,0 +1,88 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "enum_game.h"
+#include "terminal.h"
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define INPUT_BUFFER_SIZE   256     // A longer line is cut : no command is that long
+#define STANDARD_INPUT      0
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Enum Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+enum class E_Input_Status : int
+{
+    LINE    = 0,
+    TIMEOUT = 1,    // Nothing complete yet : the caller can do something else and wait again
+    CLOSED  = 2     // End of the input (end of file, closed connection)
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Command typed by a player : a move ("d3" : column d, row 3), "pass" or "quit"
+struct S_Move_Command
+{
+    E_Game_Command  command;    // NO_COMMAND for a move
+    unsigned int    column;     // From 1 to 8, as given to Place_Pawn
+    unsigned int    line;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Lines read from a file descriptor (standard input, a socket) without blocking the caller : Wait_Line waits with poll, at most the timeout
+// The bytes read after a line are kept for the next one, so several commands sent at once are all read
+// Everything read from the input must go through the same Input_Reader (std::cin keeps its own buffer, it must not read the same input)
+// On Windows the console can't be polled : the lines are read with std::getline, without timeout
+class Input_Reader
+{
+    public:
+        explicit Input_Reader(const int descriptor = STANDARD_INPUT);
+        ~Input_Reader();
+
+        Input_Reader(const Input_Reader &) = delete;
+        Input_Reader & operator=(const Input_Reader &) = delete;
+
+        E_Input_Status Wait_Line(std::string & line, const int timeout_ms = WAIT_FOREVER) noexcept;   // The line without its end of line
+        int Get_Descriptor(void) const noexcept;
+
+    protected:
+        bool Extract_Line(std::string & line) noexcept;
+
+    protected:
+        int _descriptor;
+        std::array<char, INPUT_BUFFER_SIZE> _buffer;
+        std::size_t _size;
+        bool _closed;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Input Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Command of one token, whatever the case and the spaces around : false if it is not a command
+bool Parse_Move_Command(const std::string & text, S_Move_Command & command) noexcept;
+
+#endif // INPUT_H
@@ -0,0 +1,46 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Read only view of a whole file mapped in memory (mmap, MapViewOfFile on Windows) : nothing is copied, the OS loads the pages when they are read
+// Files of several GB are opened instantly, and the pages are shared by every process which maps the same file
+class Mapped_File
+{
+    public:
+        Mapped_File();
+        ~Mapped_File();
+
+        Mapped_File(const Mapped_File &) = delete;
+        Mapped_File & operator=(const Mapped_File &) = delete;
+
+        bool Open(const std::string & path) noexcept;  // An empty file is opened, without data
+        void Close(void) noexcept;
+
+        bool Is_Open(void) const noexcept;
+        const uint8_t * Get_Data(void) const noexcept;
+        std::size_t Get_Size(void) const noexcept;
+
+    protected:
+        const uint8_t * _data;
+        std::size_t _size;
+        bool _open;
+#if defined(_WIN32)
+        void * _file;       // Windows handles, kept as void * to keep Windows.h out of this header
+        void * _mapping;
+#endif
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,67 @@
+#ifndef MOVE_ORDERING_H
+#define MOVE_ORDERING_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "pawn.h"
+
+#include <array>
+#include <cstdint>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define NUMBER_KILLERS      2           // Moves which gave the last cut-offs, kept for each number of pawns on the othellier
+#define HISTORY_LIMIT       (1 << 24)   // Once a history counter goes over this, every counter is halved
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// What the order of the moves is made of : all of them by default, the others are only turned off to measure what each one saves
+struct S_Move_Ordering_Settings
+{
+    bool hash_move;             // Best move stored in the transposition table for the position
+    bool killers;               // Moves which gave a cut-off in other positions with the same number of pawns
+    bool history;               // Moves which gave cut-offs anywhere in the tree, weighted by the depth
+    bool square_priorities;     // Corners first, the slots next to the corners last
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Order of the moves of a node : the earlier the best move is searched, the more moves are cut by alpha-beta
+// Each search thread has its own, the killers and the history are learned from the cut-offs of the thread and kept from one search to the next
+class Move_Ordering
+{
+    public:
+        Move_Ordering();
+        ~Move_Ordering();
+
+        void Set_Settings(const S_Move_Ordering_Settings & settings) noexcept;
+        void Clear(void) noexcept;          // Forgets the killers and the history
+        void New_Search(void) noexcept;     // The history of the previous searches counts half
+
+        // Legal moves sorted from the most promising one, returns their number - ply is the number of pawns on the othellier
+        unsigned int Order_Moves(const uint64_t moves, const unsigned int hash_move, const unsigned int ply, const E_Pawn_Color color,
+                                 std::array<uint8_t, NUMBER_SQUARES> & ordered_moves) const noexcept;
+
+        // The move gave a cut-off (or was the best move) at this depth
+        void Update(const unsigned int move, const unsigned int ply, const unsigned int depth, const E_Pawn_Color color) noexcept;
+
+    protected:
+        S_Move_Ordering_Settings _settings;
+        std::array<std::array<uint8_t, NUMBER_KILLERS>, NUMBER_SQUARES + 1> _killers;   // Index : number of pawns - NUMBER_SQUARES for no killer
+        std::array<std::array<uint32_t, NUMBER_SQUARES>, 2> _history;                   // Index : color (black, white), then square
+};
+
+#endif // MOVE_ORDERING_H
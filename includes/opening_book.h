@@ -0,0 +1,83 @@
+#ifndef OPENING_BOOK_H
+#define OPENING_BOOK_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "mapped_file.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Book file : file header, then the entries sorted by key (little endian, like the game records)
+// The key is the hash key of the canonical position (the smallest of its 8 symmetries, see Canonicalize in symmetry.h), pawns of the color to play as black pawns
+#define OPENING_BOOK_VERSION        1
+#define BOOK_FILE_HEADER_SIZE       16      // Magic (4 bytes), version (1 byte), reserved (3 bytes), number of entries (8 bytes)
+#define BOOK_ENTRY_SIZE             16      // Key (8), score (4), move (1), depth (1), reserved (2)
+#define DEFAULT_OPENING_BOOK_FILE   "othello.book"
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// One position of the book : the move is a square of the canonical position, Probe maps it back to the position asked
+struct S_Book_Entry
+{
+    uint64_t        key;
+    int             score;      // Search score, from the point of view of the color to play
+    unsigned int    move;
+    unsigned int    depth;      // Depth of the search which gave the move
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Read only opening book mapped in memory : a position is found by a binary search on the sorted keys, without reading the whole file
+class Opening_Book
+{
+    public:
+        Opening_Book();
+        ~Opening_Book();
+
+        Opening_Book(const Opening_Book &) = delete;
+        Opening_Book & operator=(const Opening_Book &) = delete;
+
+        bool Open(const std::string & path) noexcept;   // False if the file is not an opening book
+        void Close(void) noexcept;
+
+        bool Is_Open(void) const noexcept;
+        std::size_t Get_Number_of_Entries(void) const noexcept;
+
+        // Entry of the position, with the move as a square of this position : false if the position is not in the book
+        bool Probe(const uint64_t player, const uint64_t opponent, S_Book_Entry & entry) const noexcept;
+
+    protected:
+        Mapped_File _file;
+        std::size_t _number_of_entries;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Opening Book Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Key of the position and of its 7 symmetries : transform is the symmetry which gives the canonical position (see symmetry.h), used to map the moves
+uint64_t Get_Book_Key(const uint64_t player, const uint64_t opponent, unsigned int & transform) noexcept;
+
+// Sorts the entries and writes them in a new book file (an entry per key, the first one is kept)
+bool Write_Opening_Book(const std::string & path, std::vector<S_Book_Entry> entries) noexcept;
+
+#endif // OPENING_BOOK_H
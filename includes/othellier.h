@@ -6,10 +6,12 @@
 /* Includes */
 /*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
+#include "board_engine.h"
 #include "pawn.h"
 #include "slot.h"
 
 #include <array>
+#include <cstdint>
 #include <utility>
 
 /********************************************************************************************************************************************************************/
@@ -21,40 +23,48 @@
 #define NUMBER_ROWS     8
 #define NUMBER_COLUMNS  8
 
+// Greatest number of slots met in one direction before reaching the border (the line minus the slot where the pawn is placed)
+#define MAX_SWITCHED_PAWNS  (NUMBER_ROWS - 1)
+
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 /* Class Definition */
 /*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-class Othellier
+class Othellier : public Board_Engine
 {
     public:
         Othellier();
         ~Othellier();
 
-        bool Place_Pawn(const unsigned int position_x, const unsigned int position_y, Pawn pawn) noexcept;
-        bool Can_Play(const Pawn & pawn) const noexcept;
-        void Reset_Othellier(void) noexcept;
-        void Draw_Othellier(void) const noexcept;
-        std::pair<unsigned int, unsigned int> Count_Pawns(void) const noexcept;
-        std::pair<unsigned int, unsigned int> Count_All_Pawns(void) const noexcept;
+        bool Place_Pawn(const unsigned int position_x, const unsigned int position_y, Pawn pawn) noexcept override;
+        bool Can_Play(const Pawn & pawn) const noexcept override;
+        uint64_t Generate_Legal_Moves(const E_Pawn_Color color) const noexcept override;
+        uint64_t Get_Pawns(const E_Pawn_Color color) const noexcept override;
+        void Reset_Othellier(void) noexcept override;
+        void Draw_Othellier(void) const noexcept override;
+        std::pair<unsigned int, unsigned int> Count_Pawns(void) const noexcept override;
+        std::pair<unsigned int, unsigned int> Count_All_Pawns(void) const noexcept override;
+        unsigned int Get_Number_of_Occupied_Slots(void) const noexcept override;
+        unsigned int Get_Number_of_Free_Slots(void) const noexcept override;
 
 
     protected:
         bool Check_Pawn_Position_is_Valid(const unsigned int position_x, const unsigned int position_y) const noexcept;
-        bool Switch_Possible_Opponent_Pawns(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
+        unsigned int Switch_Possible_Opponent_Pawns(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
 
         // Functions used by Othellier::Switch_Possible_Opponent_Pawns :
-        bool Try_to_Switch_in_Up_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
-        bool Try_to_Switch_in_Down_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
-        bool Try_to_Switch_in_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
-        bool Try_to_Switch_in_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
-        bool Try_to_Switch_in_Up_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
-        bool Try_to_Switch_in_Up_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
-        bool Try_to_Switch_in_Down_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
-        bool Try_to_Switch_in_Down_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
-
-        // Functions used by Othellier::Can_Play :
+        unsigned int Try_to_Switch_in_Up_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
+        unsigned int Try_to_Switch_in_Down_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
+        unsigned int Try_to_Switch_in_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
+        unsigned int Try_to_Switch_in_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
+        unsigned int Try_to_Switch_in_Up_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
+        unsigned int Try_to_Switch_in_Up_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
+        unsigned int Try_to_Switch_in_Down_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
+        unsigned int Try_to_Switch_in_Down_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept;
+
+        // Functions used by Othellier::Can_Play and Othellier::Generate_Legal_Moves :
+        bool Is_Legal_Move(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) const noexcept;
         bool Try_to_Play_in_Up_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) const noexcept;
         bool Try_to_Play_in_Down_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) const noexcept;
         bool Try_to_Play_in_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) const noexcept;
@@ -66,6 +76,11 @@ class Othellier
 
     protected:
         std::array< std::array<Slot, NUMBER_COLUMNS>, NUMBER_ROWS> _othellier;
+
+        // Counters owned by this othellier, updated by Place_Pawn and Reset_Othellier
+        unsigned int _number_of_slots_occupied;
+        unsigned int _number_of_black_pawns;
+        unsigned int _number_of_white_pawns;
 };
 
 #endif /* OTHELLIER_H */
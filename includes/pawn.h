@@ -19,6 +19,16 @@ enum class E_Pawn_Color : int
     BLACK = 2
 };
 
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+constexpr E_Pawn_Color Get_Opponent_Color(const E_Pawn_Color color) noexcept
+{
+    return color == E_Pawn_Color::BLACK ? E_Pawn_Color::WHITE : E_Pawn_Color::BLACK;
+} // Get_Opponent_Color
+
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 /* Class Definition */
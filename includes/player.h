@@ -6,11 +6,13 @@
 /* Includes */
 /*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-#include "othellier.h"
+#include "board_engine.h"
 #include "pawn.h"
 #include "enum_game.h"
+#include "input.h"
 
 #include <memory>
+#include <string>
 #include <tuple>
 
 /********************************************************************************************************************************************************************/
@@ -21,21 +23,26 @@
 class Player
 {
     public:
-        explicit Player(const E_Pawn_Color color, std::shared_ptr<Othellier> othellier);
-        ~Player();
+        // The input is shared by the players who read the same terminal, nullptr : the player reads the standard input alone
+        explicit Player(const E_Pawn_Color color, std::shared_ptr<Board_Engine> othellier, std::shared_ptr<Input_Reader> input_reader = nullptr);
+        virtual ~Player();
 
         E_Pawn_Color Get_Color(void) const noexcept;
         bool Can_Play(void) const noexcept;
-        std::tuple<bool, E_Game_Command, unsigned int, unsigned int> Try_Place_Pawn(void) noexcept;
+        virtual std::tuple<bool, E_Game_Command, unsigned int, unsigned int> Try_Place_Pawn(void) noexcept;
+
+        // Called instead of Try_Place_Pawn when the player has no move, and once the game is over : nothing to do for a human player
+        virtual void Pass_Turn(void) noexcept;
+        virtual void End_Game(void) noexcept;
 
     protected:
-        unsigned int Ask_Position_X(void) const noexcept;
-        unsigned int Ask_Position_Y(void) const noexcept;
-        bool Ask_Quit_Game(void) const noexcept;
+        E_Input_Status Ask_Move_Command(std::string & answer) const noexcept;
+        const char * Get_Player_Name(void) const noexcept;
 
     protected:
         E_Pawn_Color _color;
-        std::shared_ptr<Othellier> _othellier;
+        std::shared_ptr<Board_Engine> _othellier;
+        std::shared_ptr<Input_Reader> _input_reader;
 };
 
 #endif // PLAYER_H
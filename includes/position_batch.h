@@ -0,0 +1,83 @@
+#ifndef POSITION_BATCH_H
+#define POSITION_BATCH_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "board_engine.h"
+#include "pawn.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Arrays of a batch, one element per position (structure of arrays) : the callers which already store their positions this way give them without any copy
+// The results are written in the output arrays, which must hold size elements each
+struct S_Batch_Arrays
+{
+    std::size_t         size;
+    const uint64_t *    players;            // Pawns of the color to play
+    const uint64_t *    opponents;          // Pawns of the other color
+    uint64_t *          legal_moves;        // Slots where the color to play can place a pawn
+    uint8_t *           mobilities;         // Number of legal moves
+    uint8_t *           player_pawns;       // Number of pawns of the color to play
+    uint8_t *           opponent_pawns;     // Number of pawns of the other color
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Batch Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Evaluates every position of the arrays in one call, 4 or 8 positions at once with the AVX2 or AVX-512 kernels (see bitboard_kernels.h)
+void Evaluate_Batch(const S_Batch_Arrays & arrays) noexcept;
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Batch of positions which owns its arrays : filled with Add, evaluated at once with Evaluate, read through the arrays
+// Clear keeps the memory, so the same batch can be filled again and again without allocation
+class Position_Batch
+{
+    public:
+        explicit Position_Batch(const std::size_t capacity = 0);
+        ~Position_Batch();
+
+        void Reserve(const std::size_t capacity);
+        void Clear(void) noexcept;
+
+        // Both return the index of the position in the batch
+        std::size_t Add(const uint64_t player, const uint64_t opponent);
+        std::size_t Add(const Board_Engine & othellier, const E_Pawn_Color color);
+
+        void Evaluate(void) noexcept;
+
+        // Arrays of Get_Size elements, the results are valid after Evaluate
+        std::size_t Get_Size(void) const noexcept;
+        const uint64_t * Get_Players(void) const noexcept;
+        const uint64_t * Get_Opponents(void) const noexcept;
+        const uint64_t * Get_Legal_Moves(void) const noexcept;
+        const uint8_t * Get_Mobilities(void) const noexcept;
+        const uint8_t * Get_Player_Pawns(void) const noexcept;
+        const uint8_t * Get_Opponent_Pawns(void) const noexcept;
+
+    protected:
+        std::vector<uint64_t> _players;
+        std::vector<uint64_t> _opponents;
+        std::vector<uint64_t> _legal_moves;
+        std::vector<uint8_t> _mobilities;
+        std::vector<uint8_t> _player_pawns;
+        std::vector<uint8_t> _opponent_pawns;
+};
+
+#endif // POSITION_BATCH_H
@@ -0,0 +1,81 @@
+#ifndef RENDERER_H
+#define RENDERER_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "board_engine.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Text of the othellier : an empty line, the X axis, the 8 rows and the Y axis
+#define OTHELLIER_TEXT_ROWS     11
+#define OTHELLIER_TEXT_COLUMNS  26
+
+// Frame of the game : the othellier, the text printed by the players goes under it
+#define DEFAULT_FRAME_ROWS      OTHELLIER_TEXT_ROWS
+#define DEFAULT_FRAME_COLUMNS   80
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Frame drawn into a buffer of characters, then sent to an ANSI terminal (any Linux terminal, Windows 10 consoles) by Present
+// Present only sends the cells which changed since the previous frame, with cursor moves, in one write : a move of the game is a few dozen bytes instead of the whole screen
+// Every buffer is allocated by the constructor, drawing and presenting a frame never allocates
+class Terminal_Renderer
+{
+    public:
+        explicit Terminal_Renderer(const unsigned int rows = DEFAULT_FRAME_ROWS, const unsigned int columns = DEFAULT_FRAME_COLUMNS, std::FILE * output = stdout);
+        ~Terminal_Renderer();
+
+        Terminal_Renderer(const Terminal_Renderer &) = delete;
+        Terminal_Renderer & operator=(const Terminal_Renderer &) = delete;
+
+        void Clear_Frame(void) noexcept;    // Every cell to a space, nothing is sent
+        void Draw_Text(const unsigned int row, const unsigned int column, const char * text) noexcept;    // Cut at the end of the row, stops at a new line
+        void Draw_Othellier(const Board_Engine & othellier, const unsigned int row = 0, const unsigned int column = 0) noexcept;
+
+        // Sends the cells which changed, then clears the screen under the frame and leaves the cursor there - returns the number of bytes written
+        std::size_t Present(void) noexcept;
+        void Invalidate(void) noexcept;     // The next frame is sent whole, after something else was written over the screen
+
+        unsigned int Get_Rows(void) const noexcept;
+        unsigned int Get_Columns(void) const noexcept;
+
+    protected:
+        void Append_Cursor_Move(const unsigned int row, const unsigned int column) noexcept;
+
+    protected:
+        unsigned int _rows;
+        unsigned int _columns;
+        std::vector<char> _frame;       // Frame being drawn, row after row
+        std::vector<char> _screen;      // Frame on the terminal
+        std::string _output;            // Bytes of the next write, reserved for the worst case
+        std::FILE * _output_file;
+        bool _full_repaint;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Display Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Text of the othellier (X : black pawns, O : white pawns), one line per row, each one ending with '\0'
+void Format_Othellier(const uint64_t black_pawns, const uint64_t white_pawns,
+                      std::array<std::array<char, OTHELLIER_TEXT_COLUMNS + 1>, OTHELLIER_TEXT_ROWS> & text) noexcept;
+
+#endif // RENDERER_H
@@ -0,0 +1,174 @@
+#ifndef SEARCH_H
+#define SEARCH_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_othellier.h"
+#include "evaluation.h"
+#include "move_ordering.h"
+#include "pawn.h"
+#include "transposition_table.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define SCORE_INFINITE      1000000
+#define SCORE_FINAL_DISC    1000    // Value of one pawn of difference once the game is over, always greater than any evaluation
+
+#define NO_MOVE             NUMBER_SQUARES
+#define MAX_SEARCH_DEPTH    MAX_PLIES
+
+#define SPLIT_MIN_DEPTH     4       // Nodes closer to the leaves are cheaper to search than to share between threads
+
+#define NO_TIME_LIMIT_MS    0xFFFFFFFFU     // Time budget of a search which only ends with Stop, Set_Time_Budget or the max depth (pondering)
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+struct S_Search_Result
+{
+    unsigned int        best_move;      // Square of the move (bitboard.h layout), NO_MOVE if the color can't play
+    int                 score;          // From the point of view of the color searched
+    unsigned int        depth;          // Last depth completely searched
+    unsigned long long  nodes;
+    unsigned long long  elapsed_ms;
+    unsigned long long  nodes_per_second;
+    unsigned long long  hash_probes;
+    unsigned long long  hash_hits;
+    unsigned int        hash_usage_permille;    // Part of the transposition table written by this search
+};
+
+// Node whose remaining moves are shared between several threads, once its first move has been searched (young brothers wait)
+struct S_Split_Point
+{
+    std::mutex          mutex;
+    S_Split_Point *     parent;         // Split point of the thread which created this one, nullptr at the top
+    uint64_t            black_pawns;    // Position of the node
+    uint64_t            white_pawns;
+    E_Pawn_Color        color;
+    unsigned int        depth;
+    int                 beta;
+    std::array<uint8_t, NUMBER_SQUARES> moves;  // Moves of the node in search order
+    unsigned int        number_of_moves;
+
+    // Protected by the mutex
+    unsigned int        next_move;      // First move not given to a thread yet
+    int                 alpha;
+    int                 best_score;
+    unsigned int        best_move;
+    unsigned int        workers;        // Threads still searching a move of this node
+
+    std::atomic<bool>   cutoff;         // Beta cut-off : every thread under this node stops
+};
+
+// Everything a thread owns during a search
+struct S_Search_Thread
+{
+    Bitboard_Othellier  othellier;
+    Pattern_Evaluator   evaluator;              // Follows the moves of the othellier, only with pattern weights
+    Move_Ordering       move_ordering;          // Killers and history of the cut-offs of this thread
+    unsigned long long  nodes;
+    unsigned long long  hash_probes;
+    unsigned long long  hash_hits;
+    S_Split_Point *     split_point;            // Innermost split point the thread is working for
+    S_Split_Point *     assigned_split_point;   // Split point given to an idle helper thread, protected by the threads mutex
+    S_Split_Point *     waiting_split_point;    // Split point the thread waits for, it only helps below it - protected by the threads mutex
+    bool                idle;                   // Protected by the threads mutex
+    std::thread         thread;                 // Not started for the main thread (index 0), which is the caller of Search
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Negamax alpha-beta with iterative deepening : each depth is searched until the time budget is spent, the last completed depth gives the move
+// Every thread shares the same transposition table : a position already searched gives its score or at least its best move, searched first
+// With several threads, the nodes deep enough are split between the idle threads once their first move is searched (Young Brothers Wait Concept)
+class Search_Engine
+{
+    public:
+        explicit Search_Engine(const unsigned int number_of_threads = 1, const std::size_t hash_size_mb = DEFAULT_HASH_SIZE_MB);
+        ~Search_Engine();
+
+        Search_Engine(const Search_Engine &) = delete;
+        Search_Engine & operator=(const Search_Engine &) = delete;
+
+        S_Search_Result Search(const Board_Engine & othellier, const E_Pawn_Color color, const unsigned int time_budget_ms, const unsigned int max_depth = MAX_SEARCH_DEPTH) noexcept;
+        void Set_Number_of_Threads(unsigned int number_of_threads);
+        unsigned int Get_Number_of_Threads(void) const noexcept;
+        void Set_Hash_Size(const std::size_t hash_size_mb);
+        void Clear_Hash(void) noexcept;     // And the killers and the history of every thread
+
+        // What the order of the moves is made of (move_ordering.h), everything by default - not during a search
+        void Set_Move_Ordering(const S_Move_Ordering_Settings & settings) noexcept;
+
+        // From any thread, while another one searches : the search ends at once with its last completed depth, or time_budget_ms from now
+        // A stop, or a time budget, also applies to the next search if none is running yet, until Clear_Stop
+        void Stop(void) noexcept;
+        void Clear_Stop(void) noexcept;
+        void Set_Time_Budget(const unsigned int time_budget_ms) noexcept;
+
+        // Best move of the position in the transposition table, its first legal move otherwise (NO_MOVE if none) - not during a search
+        unsigned int Get_Hash_Move(const Board_Engine & othellier, const E_Pawn_Color color) const noexcept;
+
+        // Pattern evaluation (evaluation.h) instead of the slot values and the mobility, nullptr to go back to them - not during a search
+        void Set_Evaluation_Weights(std::shared_ptr<const Pattern_Weights> evaluation_weights) noexcept;
+
+    protected:
+        int Search_Root(const unsigned int depth, const E_Pawn_Color color, unsigned int & best_move) noexcept;
+        int Negamax(S_Search_Thread & thread, const unsigned int depth, int alpha, int beta, const E_Pawn_Color color, const bool opponent_passed) noexcept;
+        void Make_Move(S_Search_Thread & thread, const unsigned int move, const E_Pawn_Color color) noexcept;
+        void Unmake_Move(S_Search_Thread & thread) noexcept;
+        int Evaluate(const S_Search_Thread & thread, const E_Pawn_Color color, const uint64_t player, const uint64_t opponent) const noexcept;
+        int Final_Score(const uint64_t player, const uint64_t opponent) const noexcept;
+        bool Is_Time_Over(void) noexcept;
+
+        // Parallel search
+        int Split(S_Search_Thread & thread, const std::array<uint8_t, NUMBER_SQUARES> & moves, const unsigned int first_move, const unsigned int number_of_moves,
+                  const unsigned int depth, const int alpha, const int beta, const int best_score, unsigned int & best_move, const E_Pawn_Color color) noexcept;
+        void Search_Split_Point(S_Search_Thread & thread, S_Split_Point & split_point) noexcept;
+        void Join_Split_Point(S_Search_Thread & thread, S_Split_Point & split_point) noexcept;
+        void Wait_Split_Point(S_Search_Thread & thread, S_Split_Point & split_point) noexcept;
+        bool Is_Aborted(const S_Search_Thread & thread) const noexcept;
+        bool Is_Below(const S_Split_Point & split_point, const S_Split_Point * const ancestor) const noexcept;
+        void Helper_Loop(S_Search_Thread & thread) noexcept;
+        void Stop_Helper_Threads(void) noexcept;
+
+    protected:
+        std::vector< std::unique_ptr<S_Search_Thread> > _threads;
+        std::mutex _threads_mutex;
+        std::condition_variable _threads_condition;
+        std::atomic<unsigned int> _idle_threads;
+        bool _quit;     // Protected by the threads mutex
+
+        Transposition_Table _transposition_table;
+        std::shared_ptr<const Pattern_Weights> _evaluation_weights;
+        S_Move_Ordering_Settings _move_ordering_settings;
+
+        std::atomic<bool> _stop;                // The running search is aborted (time over, or stopped)
+        std::atomic<bool> _stop_requested;      // Stop, from another thread
+        std::atomic<std::chrono::steady_clock::rep> _deadline;     // Steady clock ticks, can be moved by Set_Time_Budget during the search
+        std::atomic<std::chrono::steady_clock::rep> _requested_deadline;   // Set_Time_Budget, kept for a search which hasn't started yet - 0 if none
+};
+
+#endif // SEARCH_H
@@ -0,0 +1,99 @@
+#ifndef STABILITY_H
+#define STABILITY_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+
+#include <cstdint>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Stability Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+namespace Bitboard
+{
+    constexpr uint64_t CORNERS      {0x8100000000000081ULL};
+    constexpr uint64_t EDGES        {0xFF818181818181FFULL};
+    constexpr uint64_t TOP_BOTTOM   {0xFF000000000000FFULL};    // Rows Y = 1 and Y = 8
+    constexpr uint64_t LEFT_RIGHT   {0x8181818181818181ULL};    // Columns X = 1 and X = 8
+
+    // ------------------------------------------------------------------------------------------------------------------------------------------------
+
+    // Slots whose line in this direction (both ways) has no empty slot : no move will ever switch a pawn along it
+    template<int SHIFT, uint64_t MASK, uint64_t OPPOSITE_MASK>
+    inline uint64_t Full_Lines(const uint64_t empty) noexcept
+    {
+        return ~(Fill<SHIFT, MASK>(empty, ALL_SQUARES) | Fill<-SHIFT, OPPOSITE_MASK>(empty, ALL_SQUARES));
+    } // Full_Lines
+
+    // Slots next to any slot of the bitboard, in the 8 directions
+    inline uint64_t Get_Neighbour_Slots(const uint64_t bitboard) noexcept
+    {
+        const uint64_t line{bitboard | Shift<-1, NOT_H_FILE>(bitboard) | Shift<1, NOT_A_FILE>(bitboard)};
+        return (line | Shift<-8, ALL_SQUARES>(line) | Shift<8, ALL_SQUARES>(line)) & ~bitboard;
+    } // Get_Neighbour_Slots
+
+    // ------------------------------------------------------------------------------------------------------------------------------------------------
+
+    // Pawns which can never be switched, only from the corners : the corners, and the lines of pawns on the edges which start from a corner
+    inline uint64_t Get_Edge_Stable_Pawns(const uint64_t pawns) noexcept
+    {
+        const uint64_t stable_corners{pawns & CORNERS};
+
+        return Fill< 1, NOT_A_FILE >(stable_corners, pawns & TOP_BOTTOM)
+             | Fill<-1, NOT_H_FILE >(stable_corners, pawns & TOP_BOTTOM)
+             | Fill< 8, ALL_SQUARES>(stable_corners, pawns & LEFT_RIGHT)
+             | Fill<-8, ALL_SQUARES>(stable_corners, pawns & LEFT_RIGHT);
+    } // Get_Edge_Stable_Pawns
+
+    // Pawns of the player which can never be switched : a pawn is stable when, on each of its 4 lines, it can't be taken between an empty slot and an opponent pawn
+    // That is when the line is full, leaves the othellier at the pawn, or goes through a stable pawn of the same color next to it
+    // The edge stable pawns and the pawns on 4 full lines start the set, which grows from them until nothing changes (a lower bound of the stable pawns)
+    inline uint64_t Get_Stable_Pawns(const uint64_t player, const uint64_t opponent) noexcept
+    {
+        const uint64_t empty{~(player | opponent)};
+
+        // Lines which can't switch a pawn : full ones, and the ones leaving the othellier
+        const uint64_t horizontal   {Full_Lines<1, NOT_A_FILE, NOT_H_FILE>(empty) | LEFT_RIGHT};
+        const uint64_t vertical     {Full_Lines<8, ALL_SQUARES, ALL_SQUARES>(empty) | TOP_BOTTOM};
+        const uint64_t diagonal     {Full_Lines<9, NOT_A_FILE, NOT_H_FILE>(empty) | EDGES};
+        const uint64_t anti_diagonal{Full_Lines<7, NOT_H_FILE, NOT_A_FILE>(empty) | EDGES};
+
+        uint64_t stable{(Get_Edge_Stable_Pawns(player) | (horizontal & vertical & diagonal & anti_diagonal)) & player};
+        uint64_t previous_stable{0};
+
+        while (stable != previous_stable)
+        {
+            previous_stable = stable;
+
+            stable |= player
+                    & (horizontal    | Shift<-1, NOT_H_FILE>(stable) | Shift<1, NOT_A_FILE>(stable))
+                    & (vertical      | Shift<-8, ALL_SQUARES>(stable) | Shift<8, ALL_SQUARES>(stable))
+                    & (diagonal      | Shift<-9, NOT_H_FILE>(stable) | Shift<9, NOT_A_FILE>(stable))
+                    & (anti_diagonal | Shift<-7, NOT_A_FILE>(stable) | Shift<7, NOT_H_FILE>(stable));
+        }
+
+        return stable;
+    } // Get_Stable_Pawns
+
+    // ------------------------------------------------------------------------------------------------------------------------------------------------
+
+    // Pawns next to at least one empty slot : the ones the opponent can play against
+    inline uint64_t Get_Frontier_Pawns(const uint64_t pawns, const uint64_t empty) noexcept
+    {
+        return pawns & Get_Neighbour_Slots(empty);
+    } // Get_Frontier_Pawns
+
+    // Empty slots next to an opponent pawn : the slots where the player may be able to play later, legal or not now
+    inline uint64_t Get_Potential_Moves(const uint64_t player, const uint64_t opponent) noexcept
+    {
+        return Get_Neighbour_Slots(opponent) & ~(player | opponent);
+    } // Get_Potential_Moves
+} // namespace Bitboard
+
+#endif // STABILITY_H
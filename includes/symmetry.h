@@ -0,0 +1,141 @@
+#ifndef SYMMETRY_H
+#define SYMMETRY_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Transform : bit 0 mirrors the columns, bit 1 mirrors the rows, bit 2 swaps rows and columns, applied in this order
+// The 8 values are the 8 symmetries of the othellier (identity, 3 rotations, 4 mirrors)
+#define NUMBER_SYMMETRIES   8
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Smallest of the 8 symmetric positions, the same for all of them : Transform(position, transform) gives it, Untransform gives the position back
+struct S_Canonical_Position
+{
+    uint64_t        player;
+    uint64_t        opponent;
+    unsigned int    transform;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Symmetry Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+namespace Bitboard
+{
+    // Column X becomes column 9 - X : the bits of each row are reversed
+    inline uint64_t Mirror_Columns(uint64_t bitboard) noexcept
+    {
+        bitboard = ((bitboard >> 1) & 0x5555555555555555ULL) | ((bitboard & 0x5555555555555555ULL) << 1);
+        bitboard = ((bitboard >> 2) & 0x3333333333333333ULL) | ((bitboard & 0x3333333333333333ULL) << 2);
+        bitboard = ((bitboard >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((bitboard & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        return bitboard;
+    } // Mirror_Columns
+
+    // Row Y becomes row 9 - Y : the bytes are reversed
+    inline uint64_t Mirror_Rows(const uint64_t bitboard) noexcept
+    {
+#if defined(_MSC_VER)
+        return _byteswap_uint64(bitboard);
+#else
+        return __builtin_bswap64(bitboard);
+#endif
+    } // Mirror_Rows
+
+    // Slot (X, Y) becomes slot (Y, X) : mirror along the diagonal from the top left slot to the bottom right slot
+    inline uint64_t Swap_Rows_Columns(uint64_t bitboard) noexcept
+    {
+        uint64_t bits{0x0F0F0F0F00000000ULL & (bitboard ^ (bitboard << 28))};
+        bitboard ^= bits ^ (bits >> 28);
+        bits = 0x3333000033330000ULL & (bitboard ^ (bitboard << 14));
+        bitboard ^= bits ^ (bits >> 14);
+        bits = 0x5500550055005500ULL & (bitboard ^ (bitboard << 7));
+        bitboard ^= bits ^ (bits >> 7);
+        return bitboard;
+    } // Swap_Rows_Columns
+
+    // ------------------------------------------------------------------------------------------------------------------------------------------------
+
+    inline uint64_t Transform(uint64_t bitboard, const unsigned int transform) noexcept
+    {
+        if (transform & 1) { bitboard = Mirror_Columns(bitboard); }
+        if (transform & 2) { bitboard = Mirror_Rows(bitboard); }
+        if (transform & 4) { bitboard = Swap_Rows_Columns(bitboard); }
+        return bitboard;
+    } // Transform
+
+    // Each symmetry is its own inverse : the inverse transform applies them in the other order
+    inline uint64_t Untransform(uint64_t bitboard, const unsigned int transform) noexcept
+    {
+        if (transform & 4) { bitboard = Swap_Rows_Columns(bitboard); }
+        if (transform & 2) { bitboard = Mirror_Rows(bitboard); }
+        if (transform & 1) { bitboard = Mirror_Columns(bitboard); }
+        return bitboard;
+    } // Untransform
+
+    // Square of the transformed position for a square of the position (a move of the position -> the same move in the canonical position)
+    inline unsigned int Transform_Square(const unsigned int square, const unsigned int transform) noexcept
+    {
+        return First_Square(Transform(Square_Bit(square), transform));
+    } // Transform_Square
+
+    // Square of the position for a square of the transformed position (a move found for the canonical position -> the move to play)
+    inline unsigned int Untransform_Square(const unsigned int square, const unsigned int transform) noexcept
+    {
+        return First_Square(Untransform(Square_Bit(square), transform));
+    } // Untransform_Square
+
+    // ------------------------------------------------------------------------------------------------------------------------------------------------
+
+    // Smallest pair (player, opponent) of the 8 symmetries : 3 mirrors and 4 swaps, each symmetry built from one already computed
+    inline S_Canonical_Position Canonicalize(const uint64_t player, const uint64_t opponent) noexcept
+    {
+        uint64_t players[NUMBER_SYMMETRIES];
+        uint64_t opponents[NUMBER_SYMMETRIES];
+
+        players[0] = player;                        opponents[0] = opponent;
+        players[1] = Mirror_Columns(player);        opponents[1] = Mirror_Columns(opponent);
+        players[2] = Mirror_Rows(player);           opponents[2] = Mirror_Rows(opponent);
+        players[3] = Mirror_Rows(players[1]);       opponents[3] = Mirror_Rows(opponents[1]);
+
+        for (unsigned int transform{0}; transform < 4; ++transform)
+        {
+            players[transform + 4] = Swap_Rows_Columns(players[transform]);
+            opponents[transform + 4] = Swap_Rows_Columns(opponents[transform]);
+        }
+
+        S_Canonical_Position canonical{player, opponent, 0};
+
+        for (unsigned int transform{1}; transform < NUMBER_SYMMETRIES; ++transform)
+        {
+            if (players[transform] < canonical.player || (players[transform] == canonical.player && opponents[transform] < canonical.opponent))
+            {
+                canonical = S_Canonical_Position{players[transform], opponents[transform], transform};
+            }
+        }
+
+        return canonical;
+    } // Canonicalize
+} // namespace Bitboard
+
+#endif // SYMMETRY_H
@@ -0,0 +1,64 @@
+#ifndef TERMINAL_H
+#define TERMINAL_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include <cstddef>
+#include <string>
+
+#if !defined(_WIN32)
+#include <termios.h>
+#endif
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define NO_KEY          -1      // Read_Key : no key before the timeout, or the input is closed
+#define WAIT_FOREVER    -1      // Read_Key : no timeout
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// The console of the game : standard input and output, driven with ANSI sequences on every platform (POSIX terminals, Windows 10 consoles)
+// Every function is one write, or one read of the input : no process is started, no screen buffer is read
+// The input mode changed by Set_Raw_Input is restored by the destructor
+class Terminal
+{
+    public:
+        Terminal();
+        ~Terminal();
+
+        Terminal(const Terminal &) = delete;
+        Terminal & operator=(const Terminal &) = delete;
+
+        bool Setup(const std::string & title) noexcept;     // ANSI output (only needs to be enabled on Windows) and the title of the window
+        void Set_Title(const std::string & title) noexcept;
+        void Clear_Screen(void) noexcept;                   // And the cursor goes to the top left corner
+        void Move_Cursor(const unsigned int row, const unsigned int column) noexcept;   // From 0, 0 at the top left corner
+
+        // Raw input : each key is read as soon as it is pressed, without echo - false goes back to the lines of the terminal
+        // False if the input is not a terminal (a file or a pipe) : the keys are then read as they come
+        bool Set_Raw_Input(const bool raw) noexcept;
+        int Read_Key(const int timeout_ms = WAIT_FOREVER) noexcept;    // Character of the key, NO_KEY if none
+
+        bool Write(const char * data, const std::size_t size) noexcept;    // Everything in one write, unless the system takes it in parts
+
+    protected:
+        bool _raw_input;
+#if defined(_WIN32)
+        void * _input;      // Windows handles, kept as void * to keep Windows.h out of this header
+        void * _output;
+        unsigned long _saved_input_mode;
+#else
+        struct termios _saved_input_mode;
+#endif
+};
+
+#endif // TERMINAL_H
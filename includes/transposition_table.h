@@ -0,0 +1,89 @@
+#ifndef TRANSPOSITION_TABLE_H
+#define TRANSPOSITION_TABLE_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_HASH_SIZE_MB    64
+#define ENTRIES_PER_BUCKET      4       // One bucket fills a cache line : 4 keys and 4 datas of 8 bytes
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Enum Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+enum class E_Bound_Type : int
+{
+    NO_BOUND    = 0,
+    EXACT       = 1,    // The score is the value of the position
+    LOWER       = 2,    // The search failed high : the value is at least the score
+    UPPER       = 3     // The search failed low : the value is at most the score
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+struct S_Hash_Entry
+{
+    int             score;
+    unsigned int    depth;
+    E_Bound_Type    bound;
+    unsigned int    best_move;  // NO_MOVE (64) if unknown
+};
+
+// Each entry is stored as (key ^ data, data) : an entry torn by two threads writing at the same time doesn't pass the check, no lock is needed
+struct alignas(64) S_Hash_Bucket
+{
+    std::atomic<uint64_t> keys[ENTRIES_PER_BUCKET];
+    std::atomic<uint64_t> datas[ENTRIES_PER_BUCKET];
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Fixed size hash table shared by every search thread
+// When a bucket is full, the entry replaced is the one with the lowest depth, entries from older searches going first
+class Transposition_Table
+{
+    public:
+        explicit Transposition_Table(const std::size_t size_mb = DEFAULT_HASH_SIZE_MB);
+        ~Transposition_Table();
+
+        void Resize(const std::size_t size_mb);
+        void Clear(void) noexcept;
+        void New_Search(void) noexcept;
+
+        bool Probe(const uint64_t key, S_Hash_Entry & entry) const noexcept;
+        void Store(const uint64_t key, const unsigned int depth, const E_Bound_Type bound, const int score, const unsigned int best_move) noexcept;
+
+        std::size_t Get_Size_MB(void) const noexcept;
+        unsigned int Get_Usage_Permille(void) const noexcept; // Part of a sample of entries written by the current search
+
+    protected:
+        static uint64_t Pack(const unsigned int depth, const E_Bound_Type bound, const int score, const unsigned int best_move, const unsigned int generation) noexcept;
+        static S_Hash_Entry Unpack(const uint64_t data) noexcept;
+
+    protected:
+        std::unique_ptr<char[]> _memory;
+        S_Hash_Bucket * _buckets;           // Inside _memory, aligned on a cache line
+        std::size_t _number_of_buckets;     // Power of two, the index of a key is key & (_number_of_buckets - 1)
+        unsigned int _generation;           // Incremented by New_Search, written in every entry (8 bits)
+};
+
+#endif // TRANSPOSITION_TABLE_H
@@ -0,0 +1,75 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "pawn.h"
+
+#include <cstdint>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Random keys XORed together to identify a position : one key per slot and per color, plus one when white is the side to play
+struct S_Zobrist_Keys
+{
+    uint64_t black_pawns[NUMBER_SQUARES];
+    uint64_t white_pawns[NUMBER_SQUARES];
+    uint64_t flips[NUMBER_SQUARES];         // black_pawns ^ white_pawns : a switched pawn changes its key with a single XOR
+    uint64_t white_to_play;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// SplitMix64 : the keys are the same on every platform and every run, so hash keys can be stored in files
+constexpr uint64_t Next_Zobrist_Key(uint64_t & state) noexcept
+{
+    state += 0x9E3779B97F4A7C15ULL;
+    uint64_t key{state};
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return key ^ (key >> 31);
+} // Next_Zobrist_Key
+
+constexpr S_Zobrist_Keys Generate_Zobrist_Keys(void) noexcept
+{
+    S_Zobrist_Keys keys{};
+    uint64_t state{0x4F7468656C6C6FULL};
+
+    for (unsigned int square{0}; square < NUMBER_SQUARES; ++square)
+    {
+        keys.black_pawns[square] = Next_Zobrist_Key(state);
+        keys.white_pawns[square] = Next_Zobrist_Key(state);
+        keys.flips[square] = keys.black_pawns[square] ^ keys.white_pawns[square];
+    }
+
+    keys.white_to_play = Next_Zobrist_Key(state);
+
+    return keys;
+} // Generate_Zobrist_Keys
+
+constexpr S_Zobrist_Keys zobrist_keys{Generate_Zobrist_Keys()};
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------
+
+// Hash key of a whole othellier, the side to play excluded - only used when the position is set, moves update the key incrementally
+inline uint64_t Compute_Hash_Key(const uint64_t black_pawns, const uint64_t white_pawns) noexcept
+{
+    uint64_t hash_key{0};
+
+    for (uint64_t pawns{black_pawns}; pawns; pawns &= pawns - 1) { hash_key ^= zobrist_keys.black_pawns[Bitboard::First_Square(pawns)]; }
+    for (uint64_t pawns{white_pawns}; pawns; pawns &= pawns - 1) { hash_key ^= zobrist_keys.white_pawns[Bitboard::First_Square(pawns)]; }
+
+    return hash_key;
+} // Compute_Hash_Key
+
+#endif // ZOBRIST_H
@@ -4,24 +4,44 @@
 /*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
 #include "configuration.h"
+#include "allocation_counter.h"
 #include "othellier.h"
 #include "player.h"
-#include "slot.h"
+#include "ai_player.h"
+#include "renderer.h"
+#include "terminal.h"
 #include "enum_game.h"
+#include "game_record.h"
+#include "input.h"
 
+#include <algorithm>
+#include <ctime>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <tuple>
-#include <Windows.h>
+#include <utility>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Identifiers of the players in the game archive
+#define HUMAN_PLAYER_ID     0
+#define AI_BOT_PLAYER_ID    1
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 /* Utility Functions */
 /*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-void Setup_Windows_Terminal(void);
-void Clear_Windows_Terminal_Screen(char fill = ' ');
-void Display_Result(const E_Game_Result & game_result);
+void Setup_Terminal(Terminal & terminal);
+void Draw_Frame(Terminal_Renderer & renderer, const Board_Engine & othellier, const AI_Player * ai_player);
+void Record_Move(S_Game_Record & game_record, const std::tuple<bool, E_Game_Command, unsigned int, unsigned int> & player_result);
+void Save_Game_Record(S_Game_Record & game_record, const E_Game_Result game_result, const Board_Engine & othellier);
+bool Ask_Play_Against_AI(Terminal & terminal, Input_Reader & input_reader);
+void Display_Result(const E_Game_Result & game_result, const std::shared_ptr<Board_Engine> & othellier, Terminal & terminal, Input_Reader & input_reader);
 void Test_Game_Logic(void);
 
 /********************************************************************************************************************************************************************/
@@ -31,20 +51,57 @@ void Test_Game_Logic(void);
 
 int main()
 {
-    Setup_Windows_Terminal();
+    Terminal terminal;
+    Setup_Terminal(terminal);
 
     //Test_Game_Logic(); // FOR TESTING PURPOSE ONLY
 
-    // Create the othellier (the board game) and the players
+    // Every line typed on the terminal goes through the same reader, whichever player reads it
+    std::shared_ptr<Input_Reader> input_reader{ std::make_shared<Input_Reader>() };
+
+    // Create the othellier (the board game) and the players - player 2 can be the AI bot
     std::shared_ptr<Othellier> othellier{ std::make_shared<Othellier>() };
-    Player player_1{ E_Pawn_Color::BLACK, othellier }; // X
-    Player player_2{ E_Pawn_Color::WHITE, othellier }; // O
+    std::unique_ptr<Player> player_1{ std::make_unique<Player>(E_Pawn_Color::BLACK, othellier, input_reader) }; // X
+    std::unique_ptr<Player> player_2;                                                                           // O
+    const AI_Player * ai_player_2{nullptr};                                                                     // Player 2 when it is the AI bot
+
+    if (Ask_Play_Against_AI(terminal, *input_reader))
+    {
+        // The report of each move is drawn in the frame, under the othellier : printed after it, the next frame would clear it
+        std::unique_ptr<AI_Player> ai_player{ std::make_unique<AI_Player>(E_Pawn_Color::WHITE, othellier, DEFAULT_AI_TIME_BUDGET_MS, DEFAULT_AI_THREADS, DEFAULT_HASH_SIZE_MB, false) };
+        std::shared_ptr<Opening_Book> opening_book{ std::make_shared<Opening_Book>() };
+
+        // The book is optional : without it (see tools/book_builder.cpp), the bot searches from the first move
+        if (opening_book->Open(DEFAULT_OPENING_BOOK_FILE)) { ai_player->Set_Opening_Book(opening_book); }
+
+        // Same for the pattern weights (see evaluation.h) : without them, the search uses the slot values and the mobility
+        std::shared_ptr<Pattern_Weights> evaluation_weights{ std::make_shared<Pattern_Weights>() };
+        if (evaluation_weights->Load(DEFAULT_WEIGHTS_FILE)) { ai_player->Set_Evaluation_Weights(evaluation_weights); }
+
+        // The bot keeps searching while the human player thinks
+        ai_player->Set_Pondering(true);
+
+        ai_player_2 = ai_player.get();
+        player_2 = std::move(ai_player);
+    }
+    else
+    {
+        player_2 = std::make_unique<Player>(E_Pawn_Color::WHITE, othellier, input_reader);
+    }
+
+    // Only the slots which changed are sent to the terminal after each move, the text of the players is written under the othellier
+    // The frame holds the othellier, an empty line and the report of the last move of the AI bot
+    Terminal_Renderer renderer{OTHELLIER_TEXT_ROWS + 1 + AI_REPORT_LINES};
+    Draw_Frame(renderer, *othellier, ai_player_2);
 
     // Result of the game
     E_Game_Result game_result{E_Game_Result::NO_RESULT};
 
+    // Moves of the game, appended to the game archive once it is over
+    S_Game_Record game_record{0, HUMAN_PLAYER_ID, static_cast<uint16_t>(ai_player_2 ? AI_BOT_PLAYER_ID : HUMAN_PLAYER_ID), E_Game_Result::NO_RESULT, {0, 0}, {}};
+
     // Game Loop - The player using the black pawns always begin the game
-    while (Slot::Get_Number_of_Occupied_Slots() < MAX_PAWNS || game_result != E_Game_Result::NO_RESULT)
+    while (othellier->Get_Number_of_Occupied_Slots() < MAX_PAWNS && game_result == E_Game_Result::NO_RESULT)
     {
         // --------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -54,10 +111,10 @@ int main()
 
         // --------------------------------------------------------------------------------------------------------------------------------------------
 
-        if (player_1.Can_Play())
+        if (player_1->Can_Play())
         {
             // Blocking point in order to have a correct answer from the player. The player plays by default here.
-            while (!std::get<bool>(player_1_result)) { player_1_result = player_1.Try_Place_Pawn(); }
+            while (!std::get<bool>(player_1_result)) { player_1_result = player_1->Try_Place_Pawn(); }
 
             // We enter in this case only if the player didn't or can't play -> e.g. he requested a command instead of placing a pawn on the othellier
             if (std::get<E_Game_Command>(player_1_result) == E_Game_Command::QUIT_GAME)
@@ -66,18 +123,23 @@ int main()
                 break;
             }
         }
-        else { std::get<E_Game_Command>(player_1_result) = E_Game_Command::PASS_TURN; }
+        else
+        {
+            player_1->Pass_Turn();
+            std::get<E_Game_Command>(player_1_result) = E_Game_Command::PASS_TURN;
+        }
+
+        Record_Move(game_record, player_1_result);
 
         // Update the data displayed on the screen
-        Clear_Windows_Terminal_Screen();
-        othellier->Draw_Othellier();
+        Draw_Frame(renderer, *othellier, ai_player_2);
 
         // --------------------------------------------------------------------------------------------------------------------------------------------
 
-        if (player_2.Can_Play())
+        if (player_2->Can_Play())
         {
             // Blocking point in order to have a correct answer from the player. The player plays by default here.
-            while (!std::get<bool>(player_2_result)) { player_2_result = player_2.Try_Place_Pawn(); }
+            while (!std::get<bool>(player_2_result)) { player_2_result = player_2->Try_Place_Pawn(); }
 
             // We enter in this case only if the player didn't or can't play -> e.g. he requested a command instead of placing a pawn on the othellier
             if (std::get<E_Game_Command>(player_2_result) == E_Game_Command::QUIT_GAME)
@@ -86,7 +148,13 @@ int main()
                 break;
             }
         }
-        else { std::get<E_Game_Command>(player_2_result) = E_Game_Command::PASS_TURN; }
+        else
+        {
+            player_2->Pass_Turn();
+            std::get<E_Game_Command>(player_2_result) = E_Game_Command::PASS_TURN;
+        }
+
+        Record_Move(game_record, player_2_result);
 
         // --------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -100,11 +168,25 @@ int main()
         // --------------------------------------------------------------------------------------------------------------------------------------------
 
         // Update the data displayed on the screen
-        Clear_Windows_Terminal_Screen();
-        othellier->Draw_Othellier();
+        Draw_Frame(renderer, *othellier, ai_player_2);
     } // Game Loop
 
-    Display_Result(game_result);
+    // Whoever quit or won, the bot stops the search it runs on the time of its opponent
+    player_1->End_Game();
+    player_2->End_Game();
+
+    // The othellier is full : the winner is the one who has the greatest number of pawns
+    if (game_result == E_Game_Result::NO_RESULT)
+    {
+        auto pawns = othellier->Count_Pawns();
+
+        if      (pawns.first > pawns.second)    { game_result = E_Game_Result::PLAYER_1_WIN; }
+        else if (pawns.first < pawns.second)    { game_result = E_Game_Result::PLAYER_2_WIN; }
+        else                                    { game_result = E_Game_Result::DRAW; }
+    }
+
+    Save_Game_Record(game_record, game_result, *othellier);
+    Display_Result(game_result, othellier, terminal, *input_reader);
 
     return 1;
 } // main
@@ -112,32 +194,100 @@ int main()
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-void Setup_Windows_Terminal(void)
+void Setup_Terminal(Terminal & terminal)
+{
+    terminal.Setup("Othello [no GUI] v" + std::to_string(VERSION_HIGH) + "." + std::to_string(VERSION_LOW));
+    terminal.Clear_Screen();
+} // Setup_Terminal
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Draw_Frame(Terminal_Renderer & renderer, const Board_Engine & othellier, const AI_Player * ai_player)
 {
-    std::string terminal_title("Othello [no GUI] v" + std::to_string(VERSION_HIGH) + "." + std::to_string(VERSION_LOW));
-    std::wstring w_terminal_title(terminal_title.begin(), terminal_title.end());
-    SetConsoleTitle(w_terminal_title.data());
-}
+    renderer.Clear_Frame();
+    renderer.Draw_Othellier(othellier);
+
+    // Draw_Text stops at the end of a line : each line of the report starts after the previous new line
+    if (ai_player)
+    {
+        const std::string & report = ai_player->Get_Last_Report();
+        std::size_t line_start{0};
+
+        for (unsigned int line{0}; line < AI_REPORT_LINES && line_start < report.size(); ++line)
+        {
+            renderer.Draw_Text(OTHELLIER_TEXT_ROWS + 1 + line, 0, report.c_str() + line_start);
+
+            const std::size_t line_end{report.find('\n', line_start)};
+            if (line_end == std::string::npos) { break; }
+
+            line_start = line_end + 1;
+        }
+    }
+
+    renderer.Present();
+} // Draw_Frame
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-void Clear_Windows_Terminal_Screen(char fill)
+void Record_Move(S_Game_Record & game_record, const std::tuple<bool, E_Game_Command, unsigned int, unsigned int> & player_result)
 {
-    COORD coordinate = {0,0};
-    CONSOLE_SCREEN_BUFFER_INFO screen_buffer_info;
-    HANDLE console = GetStdHandle(STD_OUTPUT_HANDLE);
-    GetConsoleScreenBufferInfo(console, &screen_buffer_info);
-    DWORD written, cells = screen_buffer_info.dwSize.X * screen_buffer_info.dwSize.Y;
-    FillConsoleOutputCharacter(console, fill, cells, coordinate, &written);
-    FillConsoleOutputAttribute(console, screen_buffer_info.wAttributes, cells, coordinate, &written);
-    SetConsoleCursorPosition(console, coordinate);
-} // Clear_Windodws_Terminal_Screen
+    // Positions of the players go from 1 to 8, the squares of the archive are the ones of the bitboards
+    if (std::get<bool>(player_result))  { game_record.moves.push_back(static_cast<uint8_t>(Bitboard::Square_of(std::get<2>(player_result), std::get<3>(player_result)))); }
+    else                                { game_record.moves.push_back(PASS_MOVE); }
+} // Record_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Save_Game_Record(S_Game_Record & game_record, const E_Game_Result game_result, const Board_Engine & othellier)
+{
+    // The passes at the end (a full othellier, or both players blocked) are not moves, as in the archives of othello-selfplay
+    while (!game_record.moves.empty() && game_record.moves.back() == PASS_MOVE) { game_record.moves.pop_back(); }
+
+    game_record.timestamp = static_cast<uint64_t>(std::time(nullptr));
+    game_record.result = game_result;
+    game_record.pawns = othellier.Count_All_Pawns();
+
+    // The archive is continued from one game to the next, a game which can't be written is only lost
+    Game_Record_Writer archive;
+
+    if (!archive.Open(DEFAULT_GAME_ARCHIVE_FILE) || !archive.Write_Game(game_record))
+    {
+        std::cout << "The game could not be saved in " << DEFAULT_GAME_ARCHIVE_FILE << "." << std::endl;
+    }
+} // Save_Game_Record
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-void Display_Result(const E_Game_Result & game_result)
+bool Ask_Play_Against_AI(Terminal & terminal, Input_Reader & input_reader)
+{
+    std::cout << "Would you like to play against the AI bot ? (Y/N)" << std::endl;
+
+    // Get the answer : one key on a terminal, a line otherwise (input from a file or a pipe)
+    std::string answer;
+
+    if (terminal.Set_Raw_Input(true))
+    {
+        const int key{terminal.Read_Key()};
+        terminal.Set_Raw_Input(false);
+
+        if (key != NO_KEY) { answer = static_cast<char>(key); }
+    }
+    else { input_reader.Wait_Line(answer); }
+
+    // Formate the answer
+    std::transform(answer.begin(), answer.end(), answer.begin(), ::toupper);
+
+    return answer.find("Y") != std::string::npos;
+} // Ask_Play_Against_AI
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Display_Result(const E_Game_Result & game_result, const std::shared_ptr<Board_Engine> & othellier, Terminal & terminal, Input_Reader & input_reader)
 {
     // Display the game result
     switch (game_result)
@@ -167,8 +317,17 @@ void Display_Result(const E_Game_Result & game_result)
                   << "Player 2's pawns : " << pawns.second << std::endl;
     }
 
-    // Wait for any user input before closing the terminal
-    std::cin.get();
+    // Wait for any key before closing the terminal
+    if (terminal.Set_Raw_Input(true))
+    {
+        terminal.Read_Key();
+        terminal.Set_Raw_Input(false);
+    }
+    else
+    {
+        std::string line;
+        input_reader.Wait_Line(line);
+    }
 } // Display_Result
 
 /********************************************************************************************************************************************************************/
@@ -208,7 +367,12 @@ void Test_Game_Logic(void)
     //player_1.Try_Place_Pawn(4, 3); // Down Right
     //player_2.Try_Place_Pawn(3, 3); // Down Right
 
-    Clear_Windows_Terminal_Screen();
+    // Placing and switching pawns must not allocate (define COUNT_ALLOCATIONS in configuration.h, otherwise the counter stays at 0)
+    const unsigned long long allocations_before_moves{Get_Number_of_Allocations()};
+    othellier->Place_Pawn(4, 3, Pawn{ E_Pawn_Color::BLACK });
+    othellier->Place_Pawn(3, 3, Pawn{ E_Pawn_Color::WHITE });
+    std::cout << "Heap allocations while placing pawns : " << Get_Number_of_Allocations() - allocations_before_moves << std::endl;
+
     othellier->Draw_Othellier();
 
     //std::cin.get(); // do not use this while coding with Qt - it only works for a terminal [DEBUG AND CODING USES ONLY]
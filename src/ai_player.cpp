@@ -0,0 +1,303 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "ai_player.h"
+#include "othellier.h"
+
+#include <iostream>
+#include <sstream>
+#include <system_error>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+AI_Player::AI_Player(const E_Pawn_Color color, std::shared_ptr<Board_Engine> othellier, const unsigned int time_budget_ms, const unsigned int number_of_threads, const std::size_t hash_size_mb, const bool display_search)
+    : Player(color, othellier), _time_budget_ms(time_budget_ms), _max_depth(MAX_SEARCH_DEPTH), _endgame_empties(ENDGAME_SOLVER_EMPTIES), _display_search(display_search), _search_engine(number_of_threads, hash_size_mb), _endgame_solver(), _opening_book(nullptr), _last_search_result{NO_MOVE, 0, 0, 0, 0, 0, 0, 0, 0},
+      _last_report(), _pondering(false), _ponder_hit(false), _ponder_done(true), _ponder_othellier(), _ponder_result{NO_MOVE, 0, 0, 0, 0, 0, 0, 0, 0}
+{
+} // AI_Player
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+AI_Player::~AI_Player()
+{
+    Finish_Pondering();
+} // ~AI_Player
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::tuple<bool, E_Game_Command, unsigned int, unsigned int> AI_Player::Try_Place_Pawn(void) noexcept
+{
+    std::tuple<bool, E_Game_Command, unsigned int, unsigned int> result{false, E_Game_Command::NO_COMMAND, 0, 0};
+    S_Book_Entry book_entry;
+
+    _ponder_hit = Finish_Pondering();
+
+    // Ponder hit : the search started on the time of the opponent has given its move
+    if (_ponder_hit)
+    {
+        Report_Search_Result();
+    }
+    // Position of the book : its move is played at once, a move which is not legal here (corrupted book) is ignored
+    else if (_opening_book && _opening_book->Probe(_othellier->Get_Pawns(_color), _othellier->Get_Pawns(Get_Opponent_Color(_color)), book_entry)
+        && (_othellier->Generate_Legal_Moves(_color) & Bitboard::Square_Bit(book_entry.move)))
+    {
+        _last_search_result = S_Search_Result{book_entry.move, book_entry.score, book_entry.depth, 0, 0, 0, 0, 0, 0};
+
+        Report_Book_Result();
+    }
+    else if (_othellier->Get_Number_of_Free_Slots() <= _endgame_empties)
+    {
+        // Exact score : the result is kept in the same form as a search which reached the end of the game
+        const S_Endgame_Result endgame_result{_endgame_solver.Solve(*_othellier, _color)};
+
+        _last_search_result = S_Search_Result{endgame_result.best_move, endgame_result.score * SCORE_FINAL_DISC, endgame_result.empties,
+                                              endgame_result.nodes, endgame_result.elapsed_ms, endgame_result.nodes_per_second, 0, 0, 0};
+
+        Report_Endgame_Result(endgame_result);
+    }
+    else
+    {
+        _last_search_result = _search_engine.Search(*_othellier, _color, _time_budget_ms, _max_depth);
+
+        Report_Search_Result();
+    }
+
+    if (_display_search) { std::cout << std::endl << _last_report << std::endl; }
+
+    // No move found : the bot can't play
+    if (_last_search_result.best_move == NO_MOVE) { return result; }
+
+    // Positions given to the othellier go from 1 to 8
+    const unsigned int column{_last_search_result.best_move % NUMBER_COLUMNS + 1};
+    const unsigned int line  {_last_search_result.best_move / NUMBER_COLUMNS + 1};
+
+    std::get<bool>(result) = _othellier->Place_Pawn(column, line, Pawn{ _color });
+    std::get<2>(result) = column;
+    std::get<3>(result) = line;
+
+    if (std::get<bool>(result) && _pondering) { Start_Pondering(); }
+
+    return result;
+} // Try_Place_Pawn
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::Pass_Turn(void) noexcept
+{
+    // Never a ponder hit : the position searched has a move for the bot
+    Finish_Pondering();
+} // Pass_Turn
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::End_Game(void) noexcept
+{
+    Finish_Pondering();
+} // End_Game
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const S_Search_Result & AI_Player::Get_Last_Search_Result(void) const noexcept
+{
+    return _last_search_result;
+} // Get_Last_Search_Result
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const std::string & AI_Player::Get_Last_Report(void) const noexcept
+{
+    return _last_report;
+} // Get_Last_Report
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::Set_Max_Depth(const unsigned int max_depth) noexcept
+{
+    _max_depth = max_depth;
+} // Set_Max_Depth
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::Set_Endgame_Empties(const unsigned int endgame_empties) noexcept
+{
+    _endgame_empties = endgame_empties;
+} // Set_Endgame_Empties
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::New_Game(void) noexcept
+{
+    Finish_Pondering();
+    _search_engine.Clear_Hash();
+    _endgame_solver.Clear_Hash();
+    _last_search_result = S_Search_Result{NO_MOVE, 0, 0, 0, 0, 0, 0, 0, 0};
+    _last_report.clear();
+} // New_Game
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::Set_Opening_Book(std::shared_ptr<const Opening_Book> opening_book) noexcept
+{
+    _opening_book = opening_book;
+} // Set_Opening_Book
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::Set_Evaluation_Weights(std::shared_ptr<const Pattern_Weights> evaluation_weights) noexcept
+{
+    _search_engine.Set_Evaluation_Weights(evaluation_weights);
+} // Set_Evaluation_Weights
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::Set_Pondering(const bool pondering) noexcept
+{
+    _pondering = pondering;
+    if (!pondering) { Finish_Pondering(); }
+} // Set_Pondering
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::Start_Pondering(void) noexcept
+{
+    const E_Pawn_Color opponent_color{Get_Opponent_Color(_color)};
+
+    // Reply expected : the best move of the position in the hash table, filled by the search of the move just played
+    const unsigned int expected_move{_search_engine.Get_Hash_Move(*_othellier, opponent_color)};
+
+    // The opponent passes : the bot plays again at once
+    if (expected_move == NO_MOVE) { return; }
+
+    // The pondering thread gets its own copy : the othellier of the game changes with the move of the opponent
+    _ponder_othellier.Set_Othellier(_othellier->Get_Pawns(E_Pawn_Color::BLACK), _othellier->Get_Pawns(E_Pawn_Color::WHITE));
+    _ponder_othellier.Make_Move(expected_move, opponent_color);
+
+    // Only the positions where the move would come from the search : the book is instant, the endgame solver has its own hash table
+    S_Book_Entry book_entry;
+
+    if (!_ponder_othellier.Generate_Legal_Moves(_color)
+     || _ponder_othellier.Get_Number_of_Free_Slots() <= _endgame_empties
+     || (_opening_book && _opening_book->Probe(_ponder_othellier.Get_Pawns(_color), _ponder_othellier.Get_Pawns(opponent_color), book_entry)))
+    {
+        return;
+    }
+
+    _ponder_done = false;
+
+    try
+    {
+        // No time limit : the search goes on until the move of the opponent arrives (Finish_Pondering)
+        _ponder_thread = std::thread([this]()
+        {
+            const S_Search_Result ponder_result{_search_engine.Search(_ponder_othellier, _color, NO_TIME_LIMIT_MS, _max_depth)};
+
+            std::lock_guard<std::mutex> lock(_ponder_mutex);
+            _ponder_result = ponder_result;
+            _ponder_done = true;
+            _search_engine.Clear_Stop();
+        });
+    }
+    catch (const std::system_error &)
+    {
+        // No thread available : the bot only searches on its own time
+        _ponder_done = true;
+    }
+} // Start_Pondering
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool AI_Player::Finish_Pondering(void) noexcept
+{
+    if (!_ponder_thread.joinable()) { return false; }
+
+    const bool ponder_hit{_othellier->Get_Pawns(E_Pawn_Color::BLACK) == _ponder_othellier.Get_Pawns(E_Pawn_Color::BLACK)
+                       && _othellier->Get_Pawns(E_Pawn_Color::WHITE) == _ponder_othellier.Get_Pawns(E_Pawn_Color::WHITE)};
+
+    {
+        // A search which has returned must not be stopped : the stop would end the next one
+        std::lock_guard<std::mutex> lock(_ponder_mutex);
+
+        if (!_ponder_done)
+        {
+            // Ponder hit : the search becomes the search of the move, with the whole time budget from now
+            if (ponder_hit) { _search_engine.Set_Time_Budget(_time_budget_ms); }
+            else            { _search_engine.Stop(); }
+        }
+    }
+
+    _ponder_thread.join();
+
+    if (ponder_hit) { _last_search_result = _ponder_result; }
+
+    return ponder_hit;
+} // Finish_Pondering
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::Report_Search_Result(void) noexcept
+{
+    std::ostringstream report;
+
+    report << (_color == E_Pawn_Color::BLACK ? "[Player 1] " : "[Player 2] ")
+           << "AI bot (" << _search_engine.Get_Number_of_Threads() << " threads" << (_ponder_hit ? ", ponder hit" : "") << ") : depth " << _last_search_result.depth
+           << ", score " << _last_search_result.score << std::endl
+           << _last_search_result.nodes << " nodes in " << _last_search_result.elapsed_ms << " ms"
+           << " (" << _last_search_result.nodes_per_second << " nodes/s)"
+           << ", hash hits " << (_last_search_result.hash_probes ? _last_search_result.hash_hits * 100 / _last_search_result.hash_probes : 0) << " %"
+           << ", hash usage " << _last_search_result.hash_usage_permille / 10 << " %";
+
+    _last_report = report.str();
+} // Report_Search_Result
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::Report_Endgame_Result(const S_Endgame_Result & endgame_result) noexcept
+{
+    std::ostringstream report;
+
+    report << (_color == E_Pawn_Color::BLACK ? "[Player 1] " : "[Player 2] ")
+           << "AI bot (endgame solver) : " << endgame_result.empties << " empty slots"
+           << ", final score " << (endgame_result.score > 0 ? "+" : "") << endgame_result.score << std::endl
+           << endgame_result.nodes << " nodes in " << endgame_result.elapsed_ms << " ms"
+           << " (" << endgame_result.nodes_per_second << " nodes/s)";
+
+    _last_report = report.str();
+} // Report_Endgame_Result
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void AI_Player::Report_Book_Result(void) noexcept
+{
+    std::ostringstream report;
+
+    report << (_color == E_Pawn_Color::BLACK ? "[Player 1] " : "[Player 2] ")
+           << "AI bot (opening book) : depth " << _last_search_result.depth
+           << ", score " << _last_search_result.score;
+
+    _last_report = report.str();
+} // Report_Book_Result
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,87 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Variables */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static std::atomic<unsigned long long> number_of_allocations{0};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Global Operators */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef COUNT_ALLOCATIONS
+
+void * operator new(std::size_t size)
+{
+    number_of_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void * memory = std::malloc(size == 0 ? 1 : size)) { return memory; }
+    throw std::bad_alloc();
+} // operator new
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void * operator new[](std::size_t size)
+{
+    return ::operator new(size);
+} // operator new[]
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+} // operator delete
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void operator delete[](void * memory) noexcept
+{
+    std::free(memory);
+} // operator delete[]
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void operator delete(void * memory, std::size_t) noexcept
+{
+    std::free(memory);
+} // operator delete
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void operator delete[](void * memory, std::size_t) noexcept
+{
+    std::free(memory);
+} // operator delete[]
+
+#endif // COUNT_ALLOCATIONS
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+unsigned long long Get_Number_of_Allocations(void) noexcept
+{
+    return number_of_allocations.load(std::memory_order_relaxed);
+} // Get_Number_of_Allocations
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
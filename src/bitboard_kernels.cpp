@@ -0,0 +1,270 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard_kernels.h"
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Opponent pawns which can be inside a line : the lines along a row or a diagonal can't go through the columns X = 1 and X = 8 without wrapping
+#define INNER_COLUMNS   0x7E7E7E7E7E7E7E7EULL
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static uint64_t Scalar_Get_Legal_Moves(const uint64_t player, const uint64_t opponent)
+{
+    return Bitboard::Get_Legal_Moves(player, opponent);
+} // Scalar_Get_Legal_Moves
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+static uint64_t Scalar_Get_Flips(const unsigned int square, const uint64_t player, const uint64_t opponent)
+{
+    return Bitboard::Get_Flips(square, player, opponent);
+} // Scalar_Get_Flips
+
+#if defined(X86_64_KERNELS)
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Lanes of the 256 bits registers : the four directions (row, column, both diagonals), shifted left for the first half of the directions and right for the other
+// Same Kogge-Stone fill as bitboard.h, the propagator of 2 steps is computed once and used for the steps 3-4 and 5-6 (a line has 6 opponent pawns at most)
+TARGET_AVX2 static uint64_t AVX2_Get_Legal_Moves(const uint64_t player, const uint64_t opponent)
+{
+    const __m256i shifts    {_mm256_set_epi64x(7, 9, 8, 1)};
+    const __m256i shifts_2  {_mm256_add_epi64(shifts, shifts)};
+    const __m256i players   {_mm256_set1_epi64x(static_cast<long long>(player))};
+    const __m256i opponents {_mm256_and_si256(_mm256_set1_epi64x(static_cast<long long>(opponent)),
+                                              _mm256_set_epi64x(static_cast<long long>(INNER_COLUMNS), static_cast<long long>(INNER_COLUMNS), -1LL, static_cast<long long>(INNER_COLUMNS)))};
+
+    __m256i lines_left  {_mm256_and_si256(opponents, _mm256_sllv_epi64(players, shifts))};
+    __m256i lines_right {_mm256_and_si256(opponents, _mm256_srlv_epi64(players, shifts))};
+
+    lines_left  = _mm256_or_si256(lines_left,  _mm256_and_si256(opponents, _mm256_sllv_epi64(lines_left,  shifts)));
+    lines_right = _mm256_or_si256(lines_right, _mm256_and_si256(opponents, _mm256_srlv_epi64(lines_right, shifts)));
+
+    const __m256i propagator_left  {_mm256_and_si256(opponents, _mm256_sllv_epi64(opponents, shifts))};
+    const __m256i propagator_right {_mm256_srlv_epi64(propagator_left, shifts)};
+
+    lines_left  = _mm256_or_si256(lines_left,  _mm256_and_si256(propagator_left,  _mm256_sllv_epi64(lines_left,  shifts_2)));
+    lines_right = _mm256_or_si256(lines_right, _mm256_and_si256(propagator_right, _mm256_srlv_epi64(lines_right, shifts_2)));
+    lines_left  = _mm256_or_si256(lines_left,  _mm256_and_si256(propagator_left,  _mm256_sllv_epi64(lines_left,  shifts_2)));
+    lines_right = _mm256_or_si256(lines_right, _mm256_and_si256(propagator_right, _mm256_srlv_epi64(lines_right, shifts_2)));
+
+    // The slot after each line, merged over the lanes
+    const __m256i moves {_mm256_or_si256(_mm256_sllv_epi64(lines_left, shifts), _mm256_srlv_epi64(lines_right, shifts))};
+    __m128i merged      {_mm_or_si128(_mm256_castsi256_si128(moves), _mm256_extracti128_si256(moves, 1))};
+
+    merged = _mm_or_si128(merged, _mm_unpackhi_epi64(merged, merged));
+
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(merged)) & ~(player | opponent);
+} // AVX2_Get_Legal_Moves
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Same fill from the square played : a line is kept only if the slot after it holds a pawn of the player (compared in the lanes, without branch)
+TARGET_AVX2 static uint64_t AVX2_Get_Flips(const unsigned int square, const uint64_t player, const uint64_t opponent)
+{
+    const __m256i shifts    {_mm256_set_epi64x(7, 9, 8, 1)};
+    const __m256i shifts_2  {_mm256_add_epi64(shifts, shifts)};
+    const __m256i zero      {_mm256_setzero_si256()};
+    const __m256i move      {_mm256_set1_epi64x(static_cast<long long>(Bitboard::Square_Bit(square)))};
+    const __m256i players   {_mm256_set1_epi64x(static_cast<long long>(player))};
+    const __m256i opponents {_mm256_and_si256(_mm256_set1_epi64x(static_cast<long long>(opponent)),
+                                              _mm256_set_epi64x(static_cast<long long>(INNER_COLUMNS), static_cast<long long>(INNER_COLUMNS), -1LL, static_cast<long long>(INNER_COLUMNS)))};
+
+    __m256i lines_left  {_mm256_and_si256(opponents, _mm256_sllv_epi64(move, shifts))};
+    __m256i lines_right {_mm256_and_si256(opponents, _mm256_srlv_epi64(move, shifts))};
+
+    lines_left  = _mm256_or_si256(lines_left,  _mm256_and_si256(opponents, _mm256_sllv_epi64(lines_left,  shifts)));
+    lines_right = _mm256_or_si256(lines_right, _mm256_and_si256(opponents, _mm256_srlv_epi64(lines_right, shifts)));
+
+    const __m256i propagator_left  {_mm256_and_si256(opponents, _mm256_sllv_epi64(opponents, shifts))};
+    const __m256i propagator_right {_mm256_srlv_epi64(propagator_left, shifts)};
+
+    lines_left  = _mm256_or_si256(lines_left,  _mm256_and_si256(propagator_left,  _mm256_sllv_epi64(lines_left,  shifts_2)));
+    lines_right = _mm256_or_si256(lines_right, _mm256_and_si256(propagator_right, _mm256_srlv_epi64(lines_right, shifts_2)));
+    lines_left  = _mm256_or_si256(lines_left,  _mm256_and_si256(propagator_left,  _mm256_sllv_epi64(lines_left,  shifts_2)));
+    lines_right = _mm256_or_si256(lines_right, _mm256_and_si256(propagator_right, _mm256_srlv_epi64(lines_right, shifts_2)));
+
+    // Lines not closed by the player : all their bits are cleared
+    const __m256i open_left  {_mm256_cmpeq_epi64(_mm256_and_si256(_mm256_sllv_epi64(lines_left,  shifts), players), zero)};
+    const __m256i open_right {_mm256_cmpeq_epi64(_mm256_and_si256(_mm256_srlv_epi64(lines_right, shifts), players), zero)};
+
+    const __m256i flips {_mm256_or_si256(_mm256_andnot_si256(open_left, lines_left), _mm256_andnot_si256(open_right, lines_right))};
+    __m128i merged      {_mm_or_si128(_mm256_castsi256_si128(flips), _mm256_extracti128_si256(flips, 1))};
+
+    merged = _mm_or_si128(merged, _mm_unpackhi_epi64(merged, merged));
+
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(merged));
+} // AVX2_Get_Flips
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// GCC 12 headers build the 512 bits results from an "undefined" register it then reports as uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// The eight directions in the eight lanes of one register : the lanes 0-3 are shifted left, the lanes 4-7 right (the other shift of a lane is 0)
+// The propagator of 2 steps is computed the same way for both halves : opponent pawn whose previous slot in the direction is an opponent pawn too
+TARGET_AVX512 static inline __m512i AVX512_Shift(const __m512i bitboards, const __m512i shifts_left, const __m512i shifts_right)
+{
+    return _mm512_srlv_epi64(_mm512_sllv_epi64(bitboards, shifts_left), shifts_right);
+} // AVX512_Shift
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+TARGET_AVX512 static uint64_t AVX512_Get_Legal_Moves(const uint64_t player, const uint64_t opponent)
+{
+    const __m512i shifts_left    {_mm512_set_epi64(0, 0, 0, 0, 7, 9, 8, 1)};
+    const __m512i shifts_right   {_mm512_set_epi64(7, 9, 8, 1, 0, 0, 0, 0)};
+    const __m512i shifts_left_2  {_mm512_add_epi64(shifts_left,  shifts_left)};
+    const __m512i shifts_right_2 {_mm512_add_epi64(shifts_right, shifts_right)};
+    const __m512i players        {_mm512_set1_epi64(static_cast<long long>(player))};
+    const __m512i opponents      {_mm512_and_si512(_mm512_set1_epi64(static_cast<long long>(opponent)),
+                                                   _mm512_set_epi64(static_cast<long long>(INNER_COLUMNS), static_cast<long long>(INNER_COLUMNS), -1LL, static_cast<long long>(INNER_COLUMNS),
+                                                                    static_cast<long long>(INNER_COLUMNS), static_cast<long long>(INNER_COLUMNS), -1LL, static_cast<long long>(INNER_COLUMNS)))};
+
+    __m512i lines {_mm512_and_si512(opponents, AVX512_Shift(players, shifts_left, shifts_right))};
+
+    lines = _mm512_or_si512(lines, _mm512_and_si512(opponents, AVX512_Shift(lines, shifts_left, shifts_right)));
+
+    const __m512i propagator {_mm512_and_si512(opponents, AVX512_Shift(opponents, shifts_left, shifts_right))};
+
+    lines = _mm512_or_si512(lines, _mm512_and_si512(propagator, AVX512_Shift(lines, shifts_left_2, shifts_right_2)));
+    lines = _mm512_or_si512(lines, _mm512_and_si512(propagator, AVX512_Shift(lines, shifts_left_2, shifts_right_2)));
+
+    return static_cast<uint64_t>(_mm512_reduce_or_epi64(AVX512_Shift(lines, shifts_left, shifts_right))) & ~(player | opponent);
+} // AVX512_Get_Legal_Moves
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+TARGET_AVX512 static uint64_t AVX512_Get_Flips(const unsigned int square, const uint64_t player, const uint64_t opponent)
+{
+    const __m512i shifts_left    {_mm512_set_epi64(0, 0, 0, 0, 7, 9, 8, 1)};
+    const __m512i shifts_right   {_mm512_set_epi64(7, 9, 8, 1, 0, 0, 0, 0)};
+    const __m512i shifts_left_2  {_mm512_add_epi64(shifts_left,  shifts_left)};
+    const __m512i shifts_right_2 {_mm512_add_epi64(shifts_right, shifts_right)};
+    const __m512i move           {_mm512_set1_epi64(static_cast<long long>(Bitboard::Square_Bit(square)))};
+    const __m512i players        {_mm512_set1_epi64(static_cast<long long>(player))};
+    const __m512i opponents      {_mm512_and_si512(_mm512_set1_epi64(static_cast<long long>(opponent)),
+                                                   _mm512_set_epi64(static_cast<long long>(INNER_COLUMNS), static_cast<long long>(INNER_COLUMNS), -1LL, static_cast<long long>(INNER_COLUMNS),
+                                                                    static_cast<long long>(INNER_COLUMNS), static_cast<long long>(INNER_COLUMNS), -1LL, static_cast<long long>(INNER_COLUMNS)))};
+
+    __m512i lines {_mm512_and_si512(opponents, AVX512_Shift(move, shifts_left, shifts_right))};
+
+    lines = _mm512_or_si512(lines, _mm512_and_si512(opponents, AVX512_Shift(lines, shifts_left, shifts_right)));
+
+    const __m512i propagator {_mm512_and_si512(opponents, AVX512_Shift(opponents, shifts_left, shifts_right))};
+
+    lines = _mm512_or_si512(lines, _mm512_and_si512(propagator, AVX512_Shift(lines, shifts_left_2, shifts_right_2)));
+    lines = _mm512_or_si512(lines, _mm512_and_si512(propagator, AVX512_Shift(lines, shifts_left_2, shifts_right_2)));
+
+    // Only the lines closed by a pawn of the player are kept
+    const __mmask8 closed {_mm512_test_epi64_mask(AVX512_Shift(lines, shifts_left, shifts_right), players)};
+
+    return static_cast<uint64_t>(_mm512_reduce_or_epi64(_mm512_maskz_mov_epi64(closed, lines)));
+} // AVX512_Get_Flips
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // X86_64_KERNELS
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Variables */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Constant initialisation : the scalar kernels are usable before any constructor runs, the detection below replaces them during the dynamic initialisation
+S_Bitboard_Kernels Bitboard::kernels{E_Kernel_Type::SCALAR, &Scalar_Get_Legal_Moves, &Scalar_Get_Flips};
+
+static const bool kernels_selected{Bitboard::Select_Kernels(Bitboard::Detect_Kernel_Type())};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Bitboard Kernels Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+E_Kernel_Type Bitboard::Detect_Kernel_Type(void) noexcept
+{
+#if defined(X86_64_KERNELS) && defined(_MSC_VER)
+    // CPUID tells what the processor supports, XGETBV what the OS saves on a context switch (YMM for AVX2, ZMM and the mask registers for AVX-512)
+    int registers[4]{};
+
+    __cpuid(registers, 1);
+    const bool os_saves_registers{(registers[2] & (1 << 27)) != 0};
+    const unsigned long long saved_states{os_saves_registers ? _xgetbv(0) : 0};
+
+    __cpuidex(registers, 7, 0);
+    if ((registers[1] & (1 << 16)) && (saved_states & 0xE6) == 0xE6) { return E_Kernel_Type::AVX512; }
+    if ((registers[1] & (1 << 5))  && (saved_states & 0x06) == 0x06) { return E_Kernel_Type::AVX2; }
+#elif defined(X86_64_KERNELS)
+    // The builtins check the OS support as well
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl")) { return E_Kernel_Type::AVX512; }
+    if (__builtin_cpu_supports("avx2"))                                           { return E_Kernel_Type::AVX2; }
+#endif
+
+    return E_Kernel_Type::SCALAR;
+} // Detect_Kernel_Type
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Bitboard::Select_Kernels(const E_Kernel_Type type) noexcept
+{
+    if (static_cast<int>(type) > static_cast<int>(Detect_Kernel_Type())) { return false; }
+
+    switch (type)
+    {
+#if defined(X86_64_KERNELS)
+        case E_Kernel_Type::AVX512:
+            kernels = S_Bitboard_Kernels{type, &AVX512_Get_Legal_Moves, &AVX512_Get_Flips};
+            break;
+
+        case E_Kernel_Type::AVX2:
+            kernels = S_Bitboard_Kernels{type, &AVX2_Get_Legal_Moves, &AVX2_Get_Flips};
+            break;
+#endif
+
+        default:
+            kernels = S_Bitboard_Kernels{E_Kernel_Type::SCALAR, &Scalar_Get_Legal_Moves, &Scalar_Get_Flips};
+            break;
+    }
+
+    return true;
+} // Select_Kernels
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const char * Bitboard::Get_Kernel_Name(const E_Kernel_Type type) noexcept
+{
+    switch (type)
+    {
+        case E_Kernel_Type::AVX512: return "avx512";
+        case E_Kernel_Type::AVX2:   return "avx2";
+        default:                    return "scalar";
+    }
+} // Get_Kernel_Name
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,252 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard_othellier.h"
+#include "bitboard.h"
+#include "bitboard_kernels.h"
+#include "othellier.h"
+#include "renderer.h"
+#include "zobrist.h"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <iostream>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Bitboard_Othellier::Bitboard_Othellier()
+{
+    Reset_Othellier();
+} // Bitboard_Othellier
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Bitboard_Othellier::~Bitboard_Othellier()
+{
+} // ~Bitboard_Othellier
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Bitboard_Othellier::Place_Pawn(const unsigned int position_x, const unsigned int position_y, Pawn pawn) noexcept
+{
+    // Check values aren't out of bonds (the unsigned int overflow of 0 - 1 is covered by the upper bound)
+    if ((position_x - 1) >= NUMBER_COLUMNS || (position_y - 1) >= NUMBER_ROWS) { return false; }
+
+    const unsigned int square{Bitboard::Square_of(position_x, position_y)};
+    const uint64_t move{Bitboard::Square_Bit(square)};
+
+    // Check the slot is empty
+    if ((_black_pawns | _white_pawns) & move) { return false; }
+
+    const uint64_t flips{Bitboard::Fast_Flips(square, Get_Pawns(pawn.Get_Color()), Get_Opponent_Pawns(pawn.Get_Color()))};
+
+    // At least one opponent pawn must be switched
+    if (!flips) { return false; }
+
+    Make_Move(square, pawn.Get_Color());
+
+    return true;
+} // Place_Pawn
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Bitboard_Othellier::Set_Othellier(const uint64_t black_pawns, const uint64_t white_pawns) noexcept
+{
+    _black_pawns = black_pawns;
+    _white_pawns = white_pawns;
+    _hash_key = Compute_Hash_Key(_black_pawns, _white_pawns);
+    _number_of_moves_made = 0;
+} // Set_Othellier
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const S_Move_Undo & Bitboard_Othellier::Make_Move(const unsigned int square, const E_Pawn_Color color) noexcept
+{
+    const uint64_t move{Bitboard::Square_Bit(square)};
+    S_Move_Undo & undo = _undo_stack[_number_of_moves_made++];
+
+    undo.flips  = Bitboard::Fast_Flips(square, Get_Pawns(color), Get_Opponent_Pawns(color));
+    undo.hash_key = _hash_key;
+    undo.square = static_cast<unsigned char>(square);
+    undo.color  = color;
+
+    if (color == E_Pawn_Color::BLACK)
+    {
+        _black_pawns |= move | undo.flips;
+        _white_pawns ^= undo.flips;
+        _hash_key ^= zobrist_keys.black_pawns[square];
+    }
+    else
+    {
+        _white_pawns |= move | undo.flips;
+        _black_pawns ^= undo.flips;
+        _hash_key ^= zobrist_keys.white_pawns[square];
+    }
+
+    for (uint64_t flips{undo.flips}; flips; flips &= flips - 1) { _hash_key ^= zobrist_keys.flips[Bitboard::First_Square(flips)]; }
+
+    return undo;
+} // Make_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Bitboard_Othellier::Unmake_Move(void) noexcept
+{
+    if (_number_of_moves_made == 0) { return; }
+
+    const S_Move_Undo & undo = _undo_stack[--_number_of_moves_made];
+    const uint64_t move{Bitboard::Square_Bit(undo.square)};
+
+    if (undo.color == E_Pawn_Color::BLACK)
+    {
+        _black_pawns ^= move | undo.flips;
+        _white_pawns |= undo.flips;
+    }
+    else
+    {
+        _white_pawns ^= move | undo.flips;
+        _black_pawns |= undo.flips;
+    }
+
+    _hash_key = undo.hash_key;
+} // Unmake_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Bitboard_Othellier::Get_Number_of_Moves_Made(void) const noexcept
+{
+    return _number_of_moves_made;
+} // Get_Number_of_Moves_Made
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+uint64_t Bitboard_Othellier::Get_Hash_Key(void) const noexcept
+{
+    return _hash_key;
+} // Get_Hash_Key
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Bitboard_Othellier::Can_Play(const Pawn & pawn) const noexcept
+{
+    return Generate_Legal_Moves(pawn.Get_Color()) != 0;
+} // Can_Play
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+uint64_t Bitboard_Othellier::Generate_Legal_Moves(const E_Pawn_Color color) const noexcept
+{
+    return Bitboard::Fast_Legal_Moves(Get_Pawns(color), Get_Opponent_Pawns(color));
+} // Generate_Legal_Moves
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Bitboard_Othellier::Reset_Othellier(void) noexcept
+{
+    // Same starting position as Othellier::Reset_Othellier
+    _white_pawns = Bitboard::Square_Bit(Bitboard::Square_of(4, 4)) | Bitboard::Square_Bit(Bitboard::Square_of(5, 5));
+    _black_pawns = Bitboard::Square_Bit(Bitboard::Square_of(5, 4)) | Bitboard::Square_Bit(Bitboard::Square_of(4, 5));
+    _hash_key = Compute_Hash_Key(_black_pawns, _white_pawns);
+    _number_of_moves_made = 0;
+} // Reset_Othellier
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Bitboard_Othellier::Draw_Othellier(void) const noexcept
+{
+    // The whole othellier in one buffer, written at once
+    std::array<std::array<char, OTHELLIER_TEXT_COLUMNS + 1>, OTHELLIER_TEXT_ROWS> text;
+    std::array<char, OTHELLIER_TEXT_ROWS * (OTHELLIER_TEXT_COLUMNS + 1)> buffer;
+    std::size_t size{0};
+
+    Format_Othellier(Get_Pawns(E_Pawn_Color::BLACK), Get_Pawns(E_Pawn_Color::WHITE), text);
+
+    for (const auto & line : text)
+    {
+        for (std::size_t character{0}; line[character] != '\0'; ++character) { buffer[size++] = line[character]; }
+        buffer[size++] = '\n';
+    }
+
+    std::cout.write(buffer.data(), static_cast<std::streamsize>(size)).flush();
+} // Draw_Othellier
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::pair<unsigned int, unsigned int> Bitboard_Othellier::Count_Pawns(void) const noexcept
+{
+    // First = black player ; Second = white player
+    return std::make_pair(Bitboard::Count_Bits(_black_pawns), Bitboard::Count_Bits(_white_pawns));
+} // Count_Pawns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::pair<unsigned int, unsigned int> Bitboard_Othellier::Count_All_Pawns(void) const noexcept
+{
+    // First = black player ; Second = white player
+    auto pawns = Count_Pawns();
+    const unsigned int empty_slots{NUMBER_SQUARES - pawns.first - pawns.second};
+
+    // If no draw
+    if (pawns.first != pawns.second)
+    {
+        // Empty pawns are given to the player who has the greatest number of pawns
+        if (pawns.first > pawns.second) { pawns.first  += empty_slots; }
+        else                            { pawns.second += empty_slots; }
+    }
+
+    return pawns;
+} // Count_All_Pawns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Bitboard_Othellier::Get_Number_of_Occupied_Slots(void) const noexcept
+{
+    return Bitboard::Count_Bits(_black_pawns | _white_pawns);
+} // Get_Number_of_Occupied_Slots
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Bitboard_Othellier::Get_Number_of_Free_Slots(void) const noexcept
+{
+    return NUMBER_SQUARES - Get_Number_of_Occupied_Slots();
+} // Get_Number_of_Free_Slots
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+uint64_t Bitboard_Othellier::Get_Pawns(const E_Pawn_Color color) const noexcept
+{
+    return color == E_Pawn_Color::BLACK ? _black_pawns : _white_pawns;
+} // Get_Pawns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+uint64_t Bitboard_Othellier::Get_Opponent_Pawns(const E_Pawn_Color color) const noexcept
+{
+    return color == E_Pawn_Color::BLACK ? _white_pawns : _black_pawns;
+} // Get_Opponent_Pawns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,512 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "endgame.h"
+#include "bitboard.h"
+#include "bitboard_kernels.h"
+#include "stability.h"
+#include "search.h"
+
+#include <array>
+#include <chrono>
+#include <initializer_list>
+#include <utility>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define ENDGAME_SCORE_MAX   NUMBER_SQUARES      // Scores are pawns differences : always inside [-64, 64]
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Variables */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// The four 4x4 regions of the othellier, used for the parity
+static const std::array<uint64_t, 4> quadrants
+{{
+    0x000000000F0F0F0FULL,  // Top left
+    0x00000000F0F0F0F0ULL,  // Top right
+    0x0F0F0F0F00000000ULL,  // Bottom left
+    0xF0F0F0F000000000ULL   // Bottom right
+}};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Same rule as Count_All_Pawns : the empty slots are given to the winner
+static int Final_Score(const uint64_t player, const uint64_t opponent) noexcept
+{
+    const int player_pawns  {static_cast<int>(Bitboard::Count_Bits(player))};
+    const int opponent_pawns{static_cast<int>(Bitboard::Count_Bits(opponent))};
+    const int difference    {player_pawns - opponent_pawns};
+    const int empty_slots   {NUMBER_SQUARES - player_pawns - opponent_pawns};
+
+    if (difference > 0) { return difference + empty_slots; }
+    if (difference < 0) { return difference - empty_slots; }
+    return 0;
+} // Final_Score
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Slots around the square : a pawn placed there can only switch something if an opponent pawn is next to it
+static uint64_t Get_Neighbours(const unsigned int square) noexcept
+{
+    const uint64_t slot{Bitboard::Square_Bit(square)};
+    const uint64_t line{slot | Bitboard::Shift<-1, Bitboard::NOT_H_FILE>(slot) | Bitboard::Shift<1, Bitboard::NOT_A_FILE>(slot)};
+
+    return line | Bitboard::Shift<-8, Bitboard::ALL_SQUARES>(line) | Bitboard::Shift<8, Bitboard::ALL_SQUARES>(line);
+} // Get_Neighbours
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+static unsigned int Get_Quadrant(const unsigned int square) noexcept
+{
+    return ((square >> 4) & 2) | ((square >> 2) & 1);
+} // Get_Quadrant
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Key of a position for the hash table of the solver : the player to move is always the first bitboard, so the color is not needed
+static uint64_t Get_Position_Key(const uint64_t player, const uint64_t opponent) noexcept
+{
+    uint64_t key{player ^ (opponent * 0x9E3779B97F4A7C15ULL) ^ (opponent >> 29)};
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return key ^ (key >> 31);
+} // Get_Position_Key
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Endgame_Solver::Endgame_Solver(const std::size_t hash_size_mb) : _transposition_table(hash_size_mb), _nodes(0)
+{
+} // Endgame_Solver
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Endgame_Solver::~Endgame_Solver()
+{
+} // ~Endgame_Solver
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Endgame_Solver::Clear_Hash(void) noexcept
+{
+    _transposition_table.Clear();
+} // Clear_Hash
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+S_Endgame_Result Endgame_Solver::Solve(const Board_Engine & othellier, const E_Pawn_Color color) noexcept
+{
+    return Solve(othellier.Get_Pawns(color), othellier.Get_Pawns(Get_Opponent_Color(color)));
+} // Solve
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+S_Endgame_Result Endgame_Solver::Solve(const uint64_t player, const uint64_t opponent) noexcept
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    const unsigned int empties{NUMBER_SQUARES - Bitboard::Count_Bits(player | opponent)};
+    S_Endgame_Result result{NO_MOVE, 0, empties, 0, 0, 0};
+
+    _nodes = 0;
+    _transposition_table.New_Search();
+
+    uint64_t moves{Bitboard::Fast_Legal_Moves(player, opponent)};
+
+    if (!moves)
+    {
+        // The color has to pass : the score is the one of the opponent, the game may be over already
+        result.score = Bitboard::Fast_Legal_Moves(opponent, player) ? -Solve_Child(opponent, player, -ENDGAME_SCORE_MAX, ENDGAME_SCORE_MAX, empties + 1)
+                                                                   : Final_Score(player, opponent);
+    }
+    else
+    {
+        unsigned int hash_move{NO_MOVE};
+
+        // Win / draw / loss first : the null window search is much faster, and it fills the hash table with the best moves for the exact search
+        if (empties > ENDGAME_SHALLOW_EMPTIES)
+        {
+            S_Hash_Entry entry;
+
+            Solve_Deep(player, opponent, -1, 1, empties, false);
+            if (_transposition_table.Probe(Get_Position_Key(player, opponent), entry)) { hash_move = entry.best_move; }
+        }
+
+        std::array<S_Endgame_Move, NUMBER_SQUARES> ordered_moves;
+        const unsigned int number_of_moves{Sort_Moves(player, opponent, moves, hash_move, ordered_moves)};
+        int alpha{-ENDGAME_SCORE_MAX - 1};
+
+        // The first move gets the whole window, the next ones a null window first : only a better move is searched again to get its exact score
+        for (unsigned int index{0}; index < number_of_moves; ++index)
+        {
+            const S_Endgame_Move & move = ordered_moves[index];
+            const uint64_t next_player  {opponent ^ move.flips};
+            const uint64_t next_opponent{player | move.flips | Bitboard::Square_Bit(move.square)};
+
+            int score{index == 0 ? -ENDGAME_SCORE_MAX - 1 : -Solve_Child(next_player, next_opponent, -alpha - 1, -alpha, empties)};
+            if (index == 0 || score > alpha) { score = -Solve_Child(next_player, next_opponent, -ENDGAME_SCORE_MAX, -alpha, empties); }
+
+            if (index == 0 || score > alpha)
+            {
+                alpha = score;
+                result.best_move = move.square;
+            }
+        }
+
+        result.score = alpha;
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    result.nodes = _nodes;
+    result.elapsed_ms = static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+    result.nodes_per_second = static_cast<unsigned long long>(result.nodes / (std::chrono::duration<double>(elapsed).count() + 1e-9));
+
+    return result;
+} // Solve
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Search of the position reached by a move : empties is the number of empty slots before the move
+int Endgame_Solver::Solve_Child(const uint64_t player, const uint64_t opponent, const int alpha, const int beta, const unsigned int empties) noexcept
+{
+    if (empties - 1 > ENDGAME_SHALLOW_EMPTIES) { return Solve_Deep(player, opponent, alpha, beta, empties - 1, false); }
+    if (empties - 1 > 3)                       { return Solve_Shallow(player, opponent, alpha, beta, empties - 1, false); }
+
+    // Last empty slots : each one is given to a dedicated function
+    uint64_t empty{~(player | opponent)};
+
+    if (empties - 1 == 0) { return Final_Score(player, opponent); }
+
+    const unsigned int square_1{Bitboard::First_Square(empty)};
+    empty &= empty - 1;
+
+    if (empties - 1 == 1) { return Solve_1(player, opponent, square_1); }
+
+    const unsigned int square_2{Bitboard::First_Square(empty)};
+    empty &= empty - 1;
+
+    if (empties - 1 == 2) { return Solve_2(player, opponent, alpha, beta, square_1, square_2, false); }
+
+    const unsigned int square_3{Bitboard::First_Square(empty)};
+
+    // Parity : the slot alone in its region is searched first
+    if      (Get_Quadrant(square_1) == Get_Quadrant(square_2)) { return Solve_3(player, opponent, alpha, beta, square_3, square_1, square_2, false); }
+    else if (Get_Quadrant(square_1) == Get_Quadrant(square_3)) { return Solve_3(player, opponent, alpha, beta, square_2, square_1, square_3, false); }
+    return Solve_3(player, opponent, alpha, beta, square_1, square_2, square_3, false);
+} // Solve_Child
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Fastest first : the moves leaving the fewest moves to the opponent have the smallest trees and cut the most
+// The opponent moves on corners count twice, its potential moves (empty slots next to the player pawns) break the ties, the hash table move goes first
+unsigned int Endgame_Solver::Sort_Moves(const uint64_t player, const uint64_t opponent, uint64_t moves, const unsigned int hash_move, std::array<S_Endgame_Move, NUMBER_SQUARES> & ordered_moves) const noexcept
+{
+    unsigned int number_of_moves{0};
+
+    for (; moves; moves &= moves - 1)
+    {
+        S_Endgame_Move & move = ordered_moves[number_of_moves++];
+
+        move.square = Bitboard::First_Square(moves);
+        move.flips = Bitboard::Fast_Flips(move.square, player, opponent);
+
+        const uint64_t next_player  {opponent ^ move.flips};
+        const uint64_t next_opponent{player | move.flips | Bitboard::Square_Bit(move.square)};
+
+        const uint64_t next_moves{Bitboard::Fast_Legal_Moves(next_player, next_opponent)};
+        const uint64_t potential_moves{Bitboard::Get_Potential_Moves(next_player, next_opponent)};
+
+        if (move.square == hash_move) { move.priority = 0; }
+        else
+        {
+            move.priority = 1 + (Bitboard::Count_Bits(next_moves) + Bitboard::Count_Bits(next_moves & Bitboard::CORNERS)) * 8 + Bitboard::Count_Bits(potential_moves)
+                              - ((Bitboard::Square_Bit(move.square) & Bitboard::CORNERS) ? 1 : 0);
+        }
+
+        // Insertion sort : there are only a few moves
+        for (unsigned int index{number_of_moves - 1}; index > 0 && ordered_moves[index - 1].priority > ordered_moves[index].priority; --index)
+        {
+            std::swap(ordered_moves[index - 1], ordered_moves[index]);
+        }
+    }
+
+    return number_of_moves;
+} // Sort_Moves
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Endgame_Solver::Solve_Deep(const uint64_t player, const uint64_t opponent, int alpha, const int beta, const unsigned int empties, const bool opponent_passed) noexcept
+{
+    ++_nodes;
+
+    // Stability cut-off : the stable opponent pawns will still be there at the end of the game
+    // Only worth computing when even the opponent pawns all stable would be enough for a cut-off
+    if (alpha >= NUMBER_SQUARES - 2 * static_cast<int>(Bitboard::Count_Bits(opponent)))
+    {
+        const int max_score{NUMBER_SQUARES - 2 * static_cast<int>(Bitboard::Count_Bits(Bitboard::Get_Stable_Pawns(opponent, player)))};
+        if (max_score <= alpha) { return max_score; }
+    }
+
+    const bool use_hash{empties >= ENDGAME_HASH_MIN_EMPTIES};
+    const uint64_t key{use_hash ? Get_Position_Key(player, opponent) : 0};
+    unsigned int hash_move{NO_MOVE};
+    S_Hash_Entry entry;
+
+    if (use_hash && _transposition_table.Probe(key, entry))
+    {
+        // Every score stored by the solver is exact for its bound, whatever the depth
+        if (entry.bound == E_Bound_Type::EXACT)                             { return entry.score; }
+        if (entry.bound == E_Bound_Type::LOWER && entry.score >= beta)      { return entry.score; }
+        if (entry.bound == E_Bound_Type::UPPER && entry.score <= alpha)     { return entry.score; }
+
+        hash_move = entry.best_move;
+    }
+
+    uint64_t moves{Bitboard::Fast_Legal_Moves(player, opponent)};
+
+    // No move : pass, or end of the game if the opponent passed too
+    if (!moves)
+    {
+        if (opponent_passed) { return Final_Score(player, opponent); }
+        return -Solve_Deep(opponent, player, -beta, -alpha, empties, true);
+    }
+
+    std::array<S_Endgame_Move, NUMBER_SQUARES> ordered_moves;
+    const unsigned int number_of_moves{Sort_Moves(player, opponent, moves, hash_move, ordered_moves)};
+
+    // Enhanced transposition cut-off : a position reached by a move may already be in the hash table with a score good enough
+    // Only when the positions reached are deep enough to be stored
+    if (empties > ENDGAME_HASH_MIN_EMPTIES)
+    {
+        for (unsigned int index{0}; index < number_of_moves; ++index)
+        {
+            const S_Endgame_Move & move = ordered_moves[index];
+
+            if (_transposition_table.Probe(Get_Position_Key(opponent ^ move.flips, player | move.flips | Bitboard::Square_Bit(move.square)), entry)
+                && entry.bound != E_Bound_Type::LOWER && -entry.score >= beta)
+            {
+                return -entry.score;
+            }
+        }
+    }
+
+    const int original_alpha{alpha};
+    int best_score{-ENDGAME_SCORE_MAX - 1};
+    unsigned int best_move{NO_MOVE};
+
+    for (unsigned int index{0}; index < number_of_moves; ++index)
+    {
+        const S_Endgame_Move & move = ordered_moves[index];
+        const uint64_t next_player  {opponent ^ move.flips};
+        const uint64_t next_opponent{player | move.flips | Bitboard::Square_Bit(move.square)};
+
+        int score;
+
+        // Principal variation : the first move is searched with the whole window, the next ones only have to prove they are worse
+        if (index == 0)
+        {
+            score = -Solve_Child(next_player, next_opponent, -beta, -alpha, empties);
+        }
+        else
+        {
+            score = -Solve_Child(next_player, next_opponent, -alpha - 1, -alpha, empties);
+            if (score > alpha && score < beta) { score = -Solve_Child(next_player, next_opponent, -beta, -score, empties); }
+        }
+
+        if (score > best_score)
+        {
+            best_score = score;
+            best_move = move.square;
+
+            if (score > alpha)
+            {
+                alpha = score;
+                if (alpha >= beta) { break; }
+            }
+        }
+    }
+
+    if (use_hash)
+    {
+        const E_Bound_Type bound{best_score <= original_alpha ? E_Bound_Type::UPPER : (best_score >= beta ? E_Bound_Type::LOWER : E_Bound_Type::EXACT)};
+        _transposition_table.Store(key, empties, bound, best_score, best_move);
+    }
+
+    return best_score;
+} // Solve_Deep
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Endgame_Solver::Solve_Shallow(const uint64_t player, const uint64_t opponent, int alpha, const int beta, const unsigned int empties, const bool opponent_passed) noexcept
+{
+    ++_nodes;
+
+    // Parity : the last move of a region is usually an advantage, so the regions with an odd number of empty slots are played first
+    const uint64_t empty{~(player | opponent)};
+    uint64_t odd_regions{0};
+
+    for (const uint64_t quadrant : quadrants)
+    {
+        if (Bitboard::Count_Bits(empty & quadrant) & 1) { odd_regions |= quadrant; }
+    }
+
+    int best_score{-ENDGAME_SCORE_MAX - 1};
+
+    // With so few empty slots, trying each of them is cheaper than generating the legal moves
+    for (uint64_t group : {empty & odd_regions, empty & ~odd_regions})
+    {
+        for (; group; group &= group - 1)
+        {
+            const unsigned int move{Bitboard::First_Square(group)};
+            if (!(Get_Neighbours(move) & opponent)) { continue; }
+
+            const uint64_t flips{Bitboard::Fast_Flips(move, player, opponent)};
+            if (!flips) { continue; }
+
+            const int score{-Solve_Child(opponent ^ flips, player | flips | Bitboard::Square_Bit(move), -beta, -alpha, empties)};
+
+            if (score > best_score)
+            {
+                best_score = score;
+
+                if (score > alpha)
+                {
+                    alpha = score;
+                    if (alpha >= beta) { return best_score; }
+                }
+            }
+        }
+    }
+
+    // No move : pass, or end of the game if the opponent passed too
+    if (best_score == -ENDGAME_SCORE_MAX - 1)
+    {
+        if (opponent_passed) { return Final_Score(player, opponent); }
+        return -Solve_Shallow(opponent, player, -beta, -alpha, empties, true);
+    }
+
+    return best_score;
+} // Solve_Shallow
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Endgame_Solver::Solve_3(const uint64_t player, const uint64_t opponent, int alpha, const int beta, const unsigned int square_1, const unsigned int square_2, const unsigned int square_3, const bool opponent_passed) noexcept
+{
+    ++_nodes;
+
+    int best_score{-ENDGAME_SCORE_MAX - 1};
+    uint64_t flips;
+
+    // The legal moves are not generated : each empty slot is tried, a move without flips is not legal
+    if ((Get_Neighbours(square_1) & opponent) && (flips = Bitboard::Fast_Flips(square_1, player, opponent)) != 0)
+    {
+        best_score = -Solve_2(opponent ^ flips, player | flips | Bitboard::Square_Bit(square_1), -beta, -alpha, square_2, square_3, false);
+        if (best_score >= beta) { return best_score; }
+        if (best_score > alpha) { alpha = best_score; }
+    }
+
+    if ((Get_Neighbours(square_2) & opponent) && (flips = Bitboard::Fast_Flips(square_2, player, opponent)) != 0)
+    {
+        const int score{-Solve_2(opponent ^ flips, player | flips | Bitboard::Square_Bit(square_2), -beta, -alpha, square_1, square_3, false)};
+        if (score >= beta) { return score; }
+        if (score > best_score) { best_score = score; }
+        if (score > alpha) { alpha = score; }
+    }
+
+    if ((Get_Neighbours(square_3) & opponent) && (flips = Bitboard::Fast_Flips(square_3, player, opponent)) != 0)
+    {
+        const int score{-Solve_2(opponent ^ flips, player | flips | Bitboard::Square_Bit(square_3), -beta, -alpha, square_1, square_2, false)};
+        if (score > best_score) { best_score = score; }
+    }
+
+    // No move : pass, or end of the game if the opponent passed too
+    if (best_score == -ENDGAME_SCORE_MAX - 1)
+    {
+        if (opponent_passed) { return Final_Score(player, opponent); }
+        return -Solve_3(opponent, player, -beta, -alpha, square_1, square_2, square_3, true);
+    }
+
+    return best_score;
+} // Solve_3
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Endgame_Solver::Solve_2(const uint64_t player, const uint64_t opponent, int alpha, const int beta, const unsigned int square_1, const unsigned int square_2, const bool opponent_passed) noexcept
+{
+    ++_nodes;
+
+    int best_score{-ENDGAME_SCORE_MAX - 1};
+    uint64_t flips;
+
+    if ((Get_Neighbours(square_1) & opponent) && (flips = Bitboard::Fast_Flips(square_1, player, opponent)) != 0)
+    {
+        best_score = -Solve_1(opponent ^ flips, player | flips | Bitboard::Square_Bit(square_1), square_2);
+        if (best_score >= beta) { return best_score; }
+        if (best_score > alpha) { alpha = best_score; }
+    }
+
+    if ((Get_Neighbours(square_2) & opponent) && (flips = Bitboard::Fast_Flips(square_2, player, opponent)) != 0)
+    {
+        const int score{-Solve_1(opponent ^ flips, player | flips | Bitboard::Square_Bit(square_2), square_1)};
+        if (score > best_score) { best_score = score; }
+    }
+
+    if (best_score == -ENDGAME_SCORE_MAX - 1)
+    {
+        if (opponent_passed) { return Final_Score(player, opponent); }
+        return -Solve_2(opponent, player, -beta, -alpha, square_1, square_2, true);
+    }
+
+    return best_score;
+} // Solve_2
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// One empty slot : the score comes from the number of pawns switched, nothing is played
+int Endgame_Solver::Solve_1(const uint64_t player, const uint64_t opponent, const unsigned int square) noexcept
+{
+    ++_nodes;
+
+    // 63 pawns on the othellier : the player has player_pawns, the opponent 63 - player_pawns
+    const int player_pawns{static_cast<int>(Bitboard::Count_Bits(player))};
+
+    const unsigned int player_flips{Bitboard::Count_Bits(Bitboard::Fast_Flips(square, player, opponent))};
+    if (player_flips) { return 2 * (player_pawns + static_cast<int>(player_flips)) - 62; }
+
+    const unsigned int opponent_flips{Bitboard::Count_Bits(Bitboard::Fast_Flips(square, opponent, player))};
+    if (opponent_flips) { return 2 * (player_pawns - static_cast<int>(opponent_flips)) - 64; }
+
+    // Nobody can play : the empty slot goes to the winner
+    const int difference{2 * player_pawns - 63};
+    return difference > 0 ? difference + 1 : difference - 1;
+} // Solve_1
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,416 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "evaluation.h"
+#include "symmetry.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define WEIGHTS_MAGIC   "OTPW"
+#define MAGIC_SIZE      4
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Slots of one symmetry of each pattern (bitboard.h layout), the other features are found by Generate_Pattern_Tables
+struct S_Pattern_Definition
+{
+    unsigned int size;
+    unsigned int squares[MAX_PATTERN_SQUARES];
+};
+
+struct S_Pattern_Tables
+{
+    std::array<E_Pattern, NUMBER_PATTERN_FEATURES>                                  feature_patterns;
+    std::array<unsigned int, NUMBER_PATTERN_FEATURES>                               feature_sizes;
+    std::array<std::array<unsigned int, MAX_PATTERN_SQUARES>, NUMBER_PATTERN_FEATURES> feature_squares;
+    std::array<std::size_t, NUMBER_PATTERNS>                                        pattern_offsets;    // Offset of the weights of each pattern in a phase
+    std::size_t                                                                     weights_per_phase;
+
+    // For each slot, the features which contain it and the power of 3 of the slot in each of them
+    std::array<unsigned int, NUMBER_SQUARES>                                        square_counts;
+    std::array<std::array<uint16_t, MAX_SQUARE_FEATURES>, NUMBER_SQUARES>           square_features;
+    std::array<std::array<uint16_t, MAX_SQUARE_FEATURES>, NUMBER_SQUARES>           square_powers;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Variables */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Index : E_Pattern - each one starts from the top left corner
+static const S_Pattern_Definition pattern_definitions[NUMBER_PATTERNS]
+{
+    {10, { 9,  0,  1,  2,  3,  4,  5,  6,  7, 14}},    // EDGE_2X
+    { 9, { 0,  1,  2,  8,  9, 10, 16, 17, 18}},         // CORNER_3X3
+    {10, { 0,  1,  2,  3,  4,  8,  9, 10, 11, 12}},     // CORNER_2X5
+    { 8, { 0,  9, 18, 27, 36, 45, 54, 63}},             // DIAGONAL_8
+    { 7, { 1, 10, 19, 28, 37, 46, 55}},                 // DIAGONAL_7
+    { 6, { 2, 11, 20, 29, 38, 47}},                     // DIAGONAL_6
+    { 5, { 3, 12, 21, 30, 39}},                         // DIAGONAL_5
+    { 4, { 4, 13, 22, 31}},                             // DIAGONAL_4
+    { 8, { 8,  9, 10, 11, 12, 13, 14, 15}},             // LINE_2
+    { 8, {16, 17, 18, 19, 20, 21, 22, 23}},             // LINE_3
+    { 8, {24, 25, 26, 27, 28, 29, 30, 31}}              // LINE_4
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Every symmetry of every pattern, once : a symmetry which gives the same slots as another one (the edge mirrored...) is not a new feature
+static S_Pattern_Tables Generate_Pattern_Tables(void) noexcept
+{
+    S_Pattern_Tables tables{};
+    unsigned int features{0};
+    std::size_t offset{0};
+
+    for (unsigned int pattern{0}; pattern < NUMBER_PATTERNS; ++pattern)
+    {
+        const S_Pattern_Definition & definition = pattern_definitions[pattern];
+        const unsigned int first_feature{features};
+
+        tables.pattern_offsets[pattern] = offset;
+
+        std::size_t number_of_indices{1};
+        for (unsigned int square{0}; square < definition.size; ++square) { number_of_indices *= 3; }
+        offset += number_of_indices;
+
+        for (unsigned int transform{0}; transform < NUMBER_SYMMETRIES && features < NUMBER_PATTERN_FEATURES; ++transform)
+        {
+            uint64_t squares{0};
+            bool new_feature{true};
+
+            for (unsigned int square{0}; square < definition.size; ++square) { squares |= Bitboard::Square_Bit(Bitboard::Transform_Square(definition.squares[square], transform)); }
+
+            for (unsigned int feature{first_feature}; feature < features; ++feature)
+            {
+                uint64_t feature_squares{0};
+                for (unsigned int square{0}; square < definition.size; ++square) { feature_squares |= Bitboard::Square_Bit(tables.feature_squares[feature][square]); }
+                if (feature_squares == squares) { new_feature = false; }
+            }
+
+            if (!new_feature) { continue; }
+
+            tables.feature_patterns[features] = static_cast<E_Pattern>(pattern);
+            tables.feature_sizes[features] = definition.size;
+
+            // The first slot is the highest digit of the index
+            unsigned int power{static_cast<unsigned int>(number_of_indices)};
+
+            for (unsigned int square{0}; square < definition.size; ++square)
+            {
+                const unsigned int transformed_square{Bitboard::Transform_Square(definition.squares[square], transform)};
+                unsigned int & count = tables.square_counts[transformed_square];
+
+                power /= 3;
+                tables.feature_squares[features][square] = transformed_square;
+
+                if (count < MAX_SQUARE_FEATURES)
+                {
+                    tables.square_features[transformed_square][count] = static_cast<uint16_t>(features);
+                    tables.square_powers[transformed_square][count] = static_cast<uint16_t>(power);
+                    ++count;
+                }
+            }
+
+            ++features;
+        }
+    }
+
+    tables.weights_per_phase = offset;
+
+    return tables;
+} // Generate_Pattern_Tables
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+static const S_Pattern_Tables pattern_tables{Generate_Pattern_Tables()};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+static void Write_Little_Endian(uint8_t * data, const uint64_t value, const unsigned int number_of_bytes) noexcept
+{
+    for (unsigned int byte{0}; byte < number_of_bytes; ++byte) { data[byte] = static_cast<uint8_t>(value >> (8 * byte)); }
+} // Write_Little_Endian
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+static uint64_t Read_Little_Endian(const uint8_t * data, const unsigned int number_of_bytes) noexcept
+{
+    uint64_t value{0};
+
+    for (unsigned int byte{0}; byte < number_of_bytes; ++byte) { value |= static_cast<uint64_t>(data[byte]) << (8 * byte); }
+
+    return value;
+} // Read_Little_Endian
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Evaluation Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+void Compute_Pattern_Indices(const uint64_t black_pawns, const uint64_t white_pawns, uint16_t * indices) noexcept
+{
+    for (unsigned int feature{0}; feature < NUMBER_PATTERN_FEATURES; ++feature)
+    {
+        unsigned int index{0};
+
+        for (unsigned int square{0}; square < pattern_tables.feature_sizes[feature]; ++square)
+        {
+            const uint64_t bit{Bitboard::Square_Bit(pattern_tables.feature_squares[feature][square])};
+            index = index * 3 + ((black_pawns & bit) ? 1 : ((white_pawns & bit) ? 2 : 0));
+        }
+
+        indices[feature] = static_cast<uint16_t>(index);
+    }
+} // Compute_Pattern_Indices
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Get_Pattern_Phase(const unsigned int number_of_pawns) noexcept
+{
+    const unsigned int phase{number_of_pawns > 4 ? (number_of_pawns - 4) / PAWNS_PER_PATTERN_PHASE : 0};
+    return phase < NUMBER_PATTERN_PHASES ? phase : NUMBER_PATTERN_PHASES - 1;
+} // Get_Pattern_Phase
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+E_Pattern Get_Feature_Pattern(const unsigned int feature) noexcept
+{
+    return pattern_tables.feature_patterns[feature];
+} // Get_Feature_Pattern
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Get_Weight_Offset(const unsigned int phase, const unsigned int feature) noexcept
+{
+    return phase * pattern_tables.weights_per_phase + pattern_tables.pattern_offsets[static_cast<int>(pattern_tables.feature_patterns[feature])];
+} // Get_Weight_Offset
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Get_Weights_per_Phase(void) noexcept
+{
+    return pattern_tables.weights_per_phase;
+} // Get_Weights_per_Phase
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Sum_Pattern_Weights(const Pattern_Weights & weights, const uint16_t * indices, const unsigned int phase) noexcept
+{
+    const int16_t * phase_weights{weights.Get_Data() + phase * pattern_tables.weights_per_phase};
+    int sum{0};
+
+    for (unsigned int feature{0}; feature < NUMBER_PATTERN_FEATURES; ++feature)
+    {
+        sum += phase_weights[pattern_tables.pattern_offsets[static_cast<int>(pattern_tables.feature_patterns[feature])] + indices[feature]];
+    }
+
+    return sum;
+} // Sum_Pattern_Weights
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Pattern_Weights::Pattern_Weights() : _weights(NUMBER_PATTERN_PHASES * pattern_tables.weights_per_phase, 0)
+{
+} // Pattern_Weights
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Pattern_Weights::~Pattern_Weights()
+{
+} // ~Pattern_Weights
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Pattern_Weights::Load(const std::string & path) noexcept
+{
+    std::FILE * file{std::fopen(path.c_str(), "rb")};
+    if (!file) { return false; }
+
+    uint8_t header[WEIGHTS_FILE_HEADER_SIZE];
+    std::vector<uint8_t> data(_weights.size() * sizeof(int16_t));
+
+    // The file must have exactly the weights of these patterns and phases
+    bool read{std::fread(header, 1, WEIGHTS_FILE_HEADER_SIZE, file) == WEIGHTS_FILE_HEADER_SIZE
+              && std::memcmp(header, WEIGHTS_MAGIC, MAGIC_SIZE) == 0 && header[MAGIC_SIZE] == PATTERN_WEIGHTS_VERSION
+              && Read_Little_Endian(header + 8, 4) == NUMBER_PATTERN_PHASES && Read_Little_Endian(header + 12, 4) == pattern_tables.weights_per_phase
+              && std::fread(data.data(), 1, data.size(), file) == data.size() && std::fgetc(file) == EOF};
+
+    std::fclose(file);
+
+    if (!read) { return false; }
+
+    for (std::size_t weight{0}; weight < _weights.size(); ++weight)
+    {
+        _weights[weight] = static_cast<int16_t>(static_cast<uint16_t>(Read_Little_Endian(data.data() + weight * sizeof(int16_t), 2)));
+    }
+
+    return true;
+} // Load
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Pattern_Weights::Save(const std::string & path) const noexcept
+{
+    std::FILE * file{std::fopen(path.c_str(), "wb")};
+    if (!file) { return false; }
+
+    uint8_t header[WEIGHTS_FILE_HEADER_SIZE]{};
+    std::vector<uint8_t> data(_weights.size() * sizeof(int16_t));
+
+    std::memcpy(header, WEIGHTS_MAGIC, MAGIC_SIZE);
+    header[MAGIC_SIZE] = PATTERN_WEIGHTS_VERSION;
+    Write_Little_Endian(header + 8, NUMBER_PATTERN_PHASES, 4);
+    Write_Little_Endian(header + 12, pattern_tables.weights_per_phase, 4);
+
+    for (std::size_t weight{0}; weight < _weights.size(); ++weight)
+    {
+        Write_Little_Endian(data.data() + weight * sizeof(int16_t), static_cast<uint16_t>(_weights[weight]), 2);
+    }
+
+    const bool written{std::fwrite(header, 1, WEIGHTS_FILE_HEADER_SIZE, file) == WEIGHTS_FILE_HEADER_SIZE && std::fwrite(data.data(), 1, data.size(), file) == data.size()};
+
+    return std::fclose(file) == 0 && written;
+} // Save
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Pattern_Weights::Clear(void) noexcept
+{
+    std::fill(_weights.begin(), _weights.end(), 0);
+} // Clear
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int16_t * Pattern_Weights::Get_Data(void) noexcept
+{
+    return _weights.data();
+} // Get_Data
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const int16_t * Pattern_Weights::Get_Data(void) const noexcept
+{
+    return _weights.data();
+} // Get_Data
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Pattern_Weights::Get_Size(void) const noexcept
+{
+    return _weights.size();
+} // Get_Size
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Pattern_Evaluator::Pattern_Evaluator() : _indices(), _ply(0)
+{
+} // Pattern_Evaluator
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Pattern_Evaluator::~Pattern_Evaluator()
+{
+} // ~Pattern_Evaluator
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Pattern_Evaluator::Set_Position(const uint64_t black_pawns, const uint64_t white_pawns) noexcept
+{
+    _ply = 0;
+    Compute_Pattern_Indices(black_pawns, white_pawns, _indices[0].data());
+} // Set_Position
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Pattern_Evaluator::Make_Move(const unsigned int square, const uint64_t flips, const E_Pawn_Color color) noexcept
+{
+    const std::array<uint16_t, NUMBER_PATTERN_FEATURES> & previous_indices = _indices[_ply];
+    std::array<uint16_t, NUMBER_PATTERN_FEATURES> & indices = _indices[++_ply];
+
+    indices = previous_indices;
+
+    // Digit of the new pawn : 1 for black, 2 for white - a switched pawn goes from 2 to 1 for black, from 1 to 2 for white
+    const int placed_digit {color == E_Pawn_Color::BLACK ?  1 : 2};
+    const int flipped_digit{color == E_Pawn_Color::BLACK ? -1 : 1};
+
+    for (unsigned int feature{0}; feature < pattern_tables.square_counts[square]; ++feature)
+    {
+        indices[pattern_tables.square_features[square][feature]] += static_cast<uint16_t>(placed_digit * pattern_tables.square_powers[square][feature]);
+    }
+
+    for (uint64_t flipped{flips}; flipped; flipped &= flipped - 1)
+    {
+        const unsigned int flipped_square{Bitboard::First_Square(flipped)};
+
+        for (unsigned int feature{0}; feature < pattern_tables.square_counts[flipped_square]; ++feature)
+        {
+            indices[pattern_tables.square_features[flipped_square][feature]] += static_cast<uint16_t>(flipped_digit * pattern_tables.square_powers[flipped_square][feature]);
+        }
+    }
+} // Make_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Pattern_Evaluator::Unmake_Move(void) noexcept
+{
+    if (_ply > 0) { --_ply; }
+} // Unmake_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const uint16_t * Pattern_Evaluator::Get_Indices(void) const noexcept
+{
+    return _indices[_ply].data();
+} // Get_Indices
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Pattern_Evaluator::Evaluate(const Pattern_Weights & weights, const E_Pawn_Color color, const unsigned int number_of_pawns) const noexcept
+{
+    const int score{Sum_Pattern_Weights(weights, _indices[_ply].data(), Get_Pattern_Phase(number_of_pawns)) * PATTERN_PAWN_SCORE / PATTERN_WEIGHT_SCALE};
+
+    return color == E_Pawn_Color::BLACK ? score : -score;
+} // Evaluate
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,367 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "game_record.h"
+
+#include <cstring>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define ARCHIVE_MAGIC   "OTGR"
+#define INDEX_MAGIC     "OTGI"
+#define MAGIC_SIZE      4
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static void Write_Little_Endian(uint8_t * data, const uint64_t value, const unsigned int number_of_bytes) noexcept
+{
+    for (unsigned int byte{0}; byte < number_of_bytes; ++byte) { data[byte] = static_cast<uint8_t>(value >> (8 * byte)); }
+} // Write_Little_Endian
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+static uint64_t Read_Little_Endian(const uint8_t * data, const unsigned int number_of_bytes) noexcept
+{
+    uint64_t value{0};
+
+    for (unsigned int byte{0}; byte < number_of_bytes; ++byte) { value |= static_cast<uint64_t>(data[byte]) << (8 * byte); }
+
+    return value;
+} // Read_Little_Endian
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+static bool Check_File_Header(const Mapped_File & file, const char * magic) noexcept
+{
+    return file.Get_Size() >= GAME_FILE_HEADER_SIZE && std::memcmp(file.Get_Data(), magic, MAGIC_SIZE) == 0 && file.Get_Data()[MAGIC_SIZE] == GAME_RECORD_VERSION;
+} // Check_File_Header
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+static bool Write_File_Header(std::FILE * file, const char * magic) noexcept
+{
+    uint8_t header[GAME_FILE_HEADER_SIZE]{};
+
+    std::memcpy(header, magic, MAGIC_SIZE);
+    header[MAGIC_SIZE] = GAME_RECORD_VERSION;
+
+    return std::fwrite(header, 1, GAME_FILE_HEADER_SIZE, file) == GAME_FILE_HEADER_SIZE;
+} // Write_File_Header
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Game Record Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+bool Decode_Game_Record(const uint8_t * data, const std::size_t size, S_Game_Record_View & game) noexcept
+{
+    if (size < GAME_RECORD_HEADER_SIZE || size < GAME_RECORD_HEADER_SIZE + static_cast<std::size_t>(data[15])) { return false; }
+
+    game.timestamp          = Read_Little_Endian(data, 8);
+    game.player_1           = static_cast<uint16_t>(Read_Little_Endian(data + 8, 2));
+    game.player_2           = static_cast<uint16_t>(Read_Little_Endian(data + 10, 2));
+    game.result             = static_cast<E_Game_Result>(data[12]);
+    game.pawns              = std::make_pair(static_cast<unsigned int>(data[13]), static_cast<unsigned int>(data[14]));
+    game.number_of_moves    = data[15];
+    game.moves              = data + GAME_RECORD_HEADER_SIZE;
+
+    return true;
+} // Decode_Game_Record
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Game_Record_Writer::Game_Record_Writer() : _archive(nullptr), _index(nullptr), _archive_size(0), _number_of_games(0)
+{
+    _buffer.reserve(GAME_RECORD_HEADER_SIZE + MAX_RECORDED_MOVES);
+} // Game_Record_Writer
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Game_Record_Writer::~Game_Record_Writer()
+{
+    Close();
+} // ~Game_Record_Writer
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Game_Record_Writer::Open(const std::string & path) noexcept
+{
+    Close();
+
+    const std::string index_path{path + GAME_INDEX_EXTENSION};
+    bool rewrite_index{true};
+
+    // Existing archive : it must end with a complete game, and its index is written again if it doesn't match
+    {
+        Game_Record_Reader reader;
+        Mapped_File archive;
+        Mapped_File index;
+
+        if (archive.Open(path) && archive.Get_Size() > 0)
+        {
+            if (!reader.Open(path)) { return false; }
+
+            const std::size_t number_of_games{reader.Get_Number_of_Games()};
+            const std::size_t complete_size{number_of_games ? reader.Get_Game_Offset(number_of_games - 1) + GAME_RECORD_HEADER_SIZE
+                                                                + reader.Get_Game(number_of_games - 1).number_of_moves
+                                                            : GAME_FILE_HEADER_SIZE};
+
+            if (complete_size != archive.Get_Size()) { return false; }
+
+            _archive_size = archive.Get_Size();
+            _number_of_games = number_of_games;
+
+            rewrite_index = !(index.Open(index_path) && Check_File_Header(index, INDEX_MAGIC)
+                              && index.Get_Size() == GAME_FILE_HEADER_SIZE + number_of_games * GAME_INDEX_ENTRY_SIZE);
+
+            if (rewrite_index)
+            {
+                std::FILE * new_index{std::fopen(index_path.c_str(), "wb")};
+                bool written{new_index && Write_File_Header(new_index, INDEX_MAGIC)};
+
+                for (std::size_t game{0}; written && game < number_of_games; ++game)
+                {
+                    uint8_t entry[GAME_INDEX_ENTRY_SIZE];
+
+                    Write_Little_Endian(entry, reader.Get_Game_Offset(game), GAME_INDEX_ENTRY_SIZE);
+                    written = std::fwrite(entry, 1, GAME_INDEX_ENTRY_SIZE, new_index) == GAME_INDEX_ENTRY_SIZE;
+                }
+
+                if (new_index)  { written = std::fclose(new_index) == 0 && written; }
+                if (!written)   { return false; }
+
+                rewrite_index = false;
+            }
+        }
+    }
+
+    _archive = std::fopen(path.c_str(), "ab");
+    _index = std::fopen(index_path.c_str(), rewrite_index ? "wb" : "ab");
+
+    if (!_archive || !_index)
+    {
+        Close();
+        return false;
+    }
+
+    // New archive
+    if (_archive_size == 0)
+    {
+        if (!Write_File_Header(_archive, ARCHIVE_MAGIC) || !Write_File_Header(_index, INDEX_MAGIC))
+        {
+            Close();
+            return false;
+        }
+
+        _archive_size = GAME_FILE_HEADER_SIZE;
+    }
+
+    return true;
+} // Open
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Record_Writer::Close(void) noexcept
+{
+    if (_archive)   { std::fclose(_archive); }
+    if (_index)     { std::fclose(_index); }
+
+    _archive = nullptr;
+    _index = nullptr;
+    _archive_size = 0;
+    _number_of_games = 0;
+} // Close
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Game_Record_Writer::Write_Game(const S_Game_Record & game) noexcept
+{
+    if (!_archive || game.moves.size() > MAX_RECORDED_MOVES) { return false; }
+
+    _buffer.resize(GAME_RECORD_HEADER_SIZE + game.moves.size());
+
+    Write_Little_Endian(_buffer.data(),      game.timestamp, 8);
+    Write_Little_Endian(_buffer.data() + 8,  game.player_1,  2);
+    Write_Little_Endian(_buffer.data() + 10, game.player_2,  2);
+    _buffer[12] = static_cast<uint8_t>(game.result);
+    _buffer[13] = static_cast<uint8_t>(game.pawns.first);
+    _buffer[14] = static_cast<uint8_t>(game.pawns.second);
+    _buffer[15] = static_cast<uint8_t>(game.moves.size());
+
+    if (!game.moves.empty()) { std::memcpy(_buffer.data() + GAME_RECORD_HEADER_SIZE, game.moves.data(), game.moves.size()); }
+
+    uint8_t entry[GAME_INDEX_ENTRY_SIZE];
+
+    Write_Little_Endian(entry, _archive_size, GAME_INDEX_ENTRY_SIZE);
+
+    // Both files are buffered on their own : after a crash, the index may miss games of the archive or point after its end
+    // Open and the reader check the index against the archive, and write it again or read the archive to find the games
+    if (std::fwrite(_buffer.data(), 1, _buffer.size(), _archive) != _buffer.size())    { return false; }
+    if (std::fwrite(entry, 1, GAME_INDEX_ENTRY_SIZE, _index) != GAME_INDEX_ENTRY_SIZE)  { return false; }
+
+    _archive_size += _buffer.size();
+    ++_number_of_games;
+
+    return true;
+} // Write_Game
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Game_Record_Writer::Flush(void) noexcept
+{
+    return _archive && std::fflush(_archive) == 0 && std::fflush(_index) == 0;
+} // Flush
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Game_Record_Writer::Get_Number_of_Games(void) const noexcept
+{
+    return _number_of_games;
+} // Get_Number_of_Games
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Game_Record_Reader::Game_Record_Reader() : _use_index(false), _number_of_games(0)
+{
+} // Game_Record_Reader
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Game_Record_Reader::~Game_Record_Reader()
+{
+} // ~Game_Record_Reader
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Game_Record_Reader::Open(const std::string & path) noexcept
+{
+    Close();
+
+    if (!_archive.Open(path) || !Check_File_Header(_archive, ARCHIVE_MAGIC))
+    {
+        Close();
+        return false;
+    }
+
+    // The index is used if its last game is the last complete game of the archive (checked in O(1))
+    if (_index.Open(path + GAME_INDEX_EXTENSION) && Check_File_Header(_index, INDEX_MAGIC))
+    {
+        const std::size_t number_of_games{(_index.Get_Size() - GAME_FILE_HEADER_SIZE) / GAME_INDEX_ENTRY_SIZE};
+        std::size_t next_offset{GAME_FILE_HEADER_SIZE};
+        S_Game_Record_View game;
+
+        _use_index = true;
+        _number_of_games = number_of_games;
+
+        if (number_of_games > 0)
+        {
+            const std::size_t last_offset{Get_Game_Offset(number_of_games - 1)};
+
+            _use_index = last_offset >= GAME_FILE_HEADER_SIZE && last_offset < _archive.Get_Size()
+                      && Decode_Game_Record(_archive.Get_Data() + last_offset, _archive.Get_Size() - last_offset, game);
+            next_offset = last_offset + GAME_RECORD_HEADER_SIZE + game.number_of_moves;
+        }
+
+        _use_index = _use_index && !Next_Game(next_offset, game);
+    }
+
+    // Otherwise the offsets are found by reading the whole archive once
+    if (!_use_index)
+    {
+        std::size_t offset{GAME_FILE_HEADER_SIZE};
+        S_Game_Record_View game;
+
+        _index.Close();
+        _offsets.clear();
+
+        for (std::size_t game_offset{offset}; Next_Game(offset, game); game_offset = offset) { _offsets.push_back(game_offset); }
+
+        _number_of_games = _offsets.size();
+    }
+
+    return true;
+} // Open
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Record_Reader::Close(void) noexcept
+{
+    _archive.Close();
+    _index.Close();
+    _use_index = false;
+    _offsets.clear();
+    _offsets.shrink_to_fit();
+    _number_of_games = 0;
+} // Close
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Game_Record_Reader::Get_Number_of_Games(void) const noexcept
+{
+    return _number_of_games;
+} // Get_Number_of_Games
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Game_Record_Reader::Get_Game_Offset(const std::size_t game) const noexcept
+{
+    if (_use_index) { return static_cast<std::size_t>(Read_Little_Endian(_index.Get_Data() + GAME_FILE_HEADER_SIZE + game * GAME_INDEX_ENTRY_SIZE, GAME_INDEX_ENTRY_SIZE)); }
+
+    return static_cast<std::size_t>(_offsets[game]);
+} // Get_Game_Offset
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+S_Game_Record_View Game_Record_Reader::Get_Game(const std::size_t game) const noexcept
+{
+    // The game must be one of the Get_Number_of_Games games : Open checked they are all complete
+    const std::size_t offset{Get_Game_Offset(game)};
+    S_Game_Record_View view;
+
+    Decode_Game_Record(_archive.Get_Data() + offset, _archive.Get_Size() - offset, view);
+
+    return view;
+} // Get_Game
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Game_Record_Reader::Next_Game(std::size_t & offset, S_Game_Record_View & game) const noexcept
+{
+    if (offset < GAME_FILE_HEADER_SIZE) { offset = GAME_FILE_HEADER_SIZE; }
+    if (offset >= _archive.Get_Size() || !Decode_Game_Record(_archive.Get_Data() + offset, _archive.Get_Size() - offset, game)) { return false; }
+
+    offset += GAME_RECORD_HEADER_SIZE + game.number_of_moves;
+
+    return true;
+} // Next_Game
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,843 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "game_server.h"
+#include "bitboard.h"
+#include "input.h"
+#include "othellier.h"
+#include "search.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Identifiers of the epoll events which are not connections
+#define LISTEN_EVENT_ID     0
+#define WORKER_EVENT_ID     1
+#define FIRST_CONNECTION_ID 2
+
+#define LISTEN_BACKLOG      1024
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static char Color_Letter(const E_Pawn_Color color) noexcept
+{
+    return color == E_Pawn_Color::BLACK ? 'B' : 'W';
+} // Color_Letter
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Latency_Histogram::Latency_Histogram()
+{
+    Clear();
+} // Latency_Histogram
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Latency_Histogram::~Latency_Histogram()
+{
+} // ~Latency_Histogram
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Latency_Histogram::Clear(void) noexcept
+{
+    _buckets.fill(0);
+    _count = 0;
+    _max_ns = 0;
+} // Clear
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Latency_Histogram::Add(const unsigned long long duration_ns) noexcept
+{
+    ++_buckets[Get_Bucket(duration_ns)];
+    ++_count;
+    _max_ns = std::max(_max_ns, duration_ns);
+} // Add
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned long long Latency_Histogram::Get_Count(void) const noexcept
+{
+    return _count;
+} // Get_Count
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned long long Latency_Histogram::Get_Percentile_ns(const double percentile) const noexcept
+{
+    if (_count == 0) { return 0; }
+
+    // Rank of the duration, from 1 : the 99th percentile of 100 durations is the 99th one
+    const unsigned long long rank{std::max(1ULL, static_cast<unsigned long long>(percentile / 100.0 * static_cast<double>(_count) + 0.999999))};
+    unsigned long long seen{0};
+
+    for (unsigned int bucket{0}; bucket < NUMBER_LATENCY_BUCKETS; ++bucket)
+    {
+        seen += _buckets[bucket];
+        if (seen >= rank) { return std::min(_max_ns, Get_Bucket_Limit(bucket)); }
+    }
+
+    return _max_ns;
+} // Get_Percentile_ns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Latency_Histogram::Get_Bucket(const unsigned long long duration_ns) noexcept
+{
+    constexpr unsigned long long SUB_BUCKETS{1ULL << LATENCY_SUB_BUCKET_BITS};
+
+    // The durations under 16 ns have a bucket each, then the 4 bits under the highest one give the bucket in its power of two
+    if (duration_ns < SUB_BUCKETS) { return static_cast<unsigned int>(duration_ns); }
+
+    unsigned int highest_bit{0};
+    while ((duration_ns >> highest_bit) > 1) { ++highest_bit; }
+
+    const unsigned int shift{highest_bit - LATENCY_SUB_BUCKET_BITS};
+    return ((shift + 1) << LATENCY_SUB_BUCKET_BITS) + static_cast<unsigned int>((duration_ns >> shift) & (SUB_BUCKETS - 1));
+} // Get_Bucket
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned long long Latency_Histogram::Get_Bucket_Limit(const unsigned int bucket) noexcept
+{
+    constexpr unsigned long long SUB_BUCKETS{1ULL << LATENCY_SUB_BUCKET_BITS};
+
+    if (bucket < SUB_BUCKETS) { return bucket; }
+
+    // Greatest duration of the bucket
+    const unsigned int shift{(bucket >> LATENCY_SUB_BUCKET_BITS) - 1};
+    return (((SUB_BUCKETS + (bucket & (SUB_BUCKETS - 1))) + 1) << shift) - 1;
+} // Get_Bucket_Limit
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Game_Server::Game_Server(const unsigned int number_of_workers)
+    : _listen_descriptor(-1), _epoll_descriptor(-1), _event_descriptor(-1), _quit(false), _next_connection_id(FIRST_CONNECTION_ID), _next_game_id(1),
+      _start(std::chrono::steady_clock::now()), _matches(0), _moves(0), _bot_moves(0),
+      _number_of_workers(number_of_workers > 0 ? number_of_workers : std::max(1U, std::thread::hardware_concurrency())), _stop_workers(false)
+{
+} // Game_Server
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Game_Server::~Game_Server()
+{
+    Stop_Workers();
+
+#if defined(__linux__)
+    for (auto & connection : _connections) { ::close(connection.second->descriptor); }
+
+    if (_listen_descriptor >= 0)    { ::close(_listen_descriptor); }
+    if (_event_descriptor >= 0)     { ::close(_event_descriptor); }
+    if (_epoll_descriptor >= 0)     { ::close(_epoll_descriptor); }
+    if (!_unix_path.empty())        { ::unlink(_unix_path.c_str()); }
+#endif
+} // ~Game_Server
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Game_Server::Listen(const S_Server_Address & address) noexcept
+{
+#if defined(__linux__)
+    if (_listen_descriptor >= 0) { return false; }
+
+    _listen_descriptor = ::socket(address.unix_socket ? AF_UNIX : AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (_listen_descriptor < 0) { return false; }
+
+    bool bound{false};
+
+    if (address.unix_socket)
+    {
+        struct sockaddr_un socket_address{};
+        socket_address.sun_family = AF_UNIX;
+        if (address.path.size() >= sizeof(socket_address.sun_path)) { return false; }
+        std::copy(address.path.begin(), address.path.end(), socket_address.sun_path);
+
+        // A socket file left by a previous server would make bind fail
+        ::unlink(address.path.c_str());
+        bound = ::bind(_listen_descriptor, reinterpret_cast<const struct sockaddr *>(&socket_address), sizeof(socket_address)) == 0;
+        if (bound) { _unix_path = address.path; }
+    }
+    else
+    {
+        struct sockaddr_in socket_address{};
+        socket_address.sin_family = AF_INET;
+        socket_address.sin_port = htons(address.port);
+        if (::inet_pton(AF_INET, address.host.c_str(), &socket_address.sin_addr) != 1) { return false; }
+
+        const int reuse{1};
+        ::setsockopt(_listen_descriptor, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        bound = ::bind(_listen_descriptor, reinterpret_cast<const struct sockaddr *>(&socket_address), sizeof(socket_address)) == 0;
+    }
+
+    if (!bound || ::listen(_listen_descriptor, LISTEN_BACKLOG) != 0) { return false; }
+
+    _epoll_descriptor = ::epoll_create1(EPOLL_CLOEXEC);
+    _event_descriptor = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_epoll_descriptor < 0 || _event_descriptor < 0) { return false; }
+
+    struct epoll_event listen_event{};
+    listen_event.events = EPOLLIN;
+    listen_event.data.u64 = LISTEN_EVENT_ID;
+
+    struct epoll_event worker_event{};
+    worker_event.events = EPOLLIN;
+    worker_event.data.u64 = WORKER_EVENT_ID;
+
+    if (::epoll_ctl(_epoll_descriptor, EPOLL_CTL_ADD, _listen_descriptor, &listen_event) != 0
+     || ::epoll_ctl(_epoll_descriptor, EPOLL_CTL_ADD, _event_descriptor, &worker_event) != 0)
+    {
+        return false;
+    }
+
+    return true;
+#else
+    (void)address;
+    return false;
+#endif
+} // Listen
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Run(const unsigned int report_interval_s) noexcept
+{
+#if defined(__linux__)
+    if (_epoll_descriptor < 0) { return; }
+
+    // The workers are only started once the server can serve : a server which can't listen costs nothing
+    {
+        std::lock_guard<std::mutex> lock(_jobs_mutex);
+        _stop_workers = false;
+    }
+
+    for (unsigned int worker{0}; worker < _number_of_workers; ++worker) { _workers.emplace_back([this]() { Worker_Loop(); }); }
+
+    _start = std::chrono::steady_clock::now();
+    auto next_report = _start + std::chrono::seconds(report_interval_s);
+    std::array<struct epoll_event, SERVER_MAX_EVENTS> events;
+
+    while (!_quit)
+    {
+        int timeout_ms{-1};
+
+        if (report_interval_s > 0)
+        {
+            const auto now = std::chrono::steady_clock::now();
+
+            if (now >= next_report)
+            {
+                std::cout << Format_Statistics() << std::endl;
+                next_report += std::chrono::seconds(report_interval_s);
+            }
+
+            timeout_ms = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(next_report - now).count()) + 1;
+        }
+
+        const int number_of_events{::epoll_wait(_epoll_descriptor, events.data(), SERVER_MAX_EVENTS, timeout_ms)};
+
+        for (int index{0}; index < number_of_events; ++index)
+        {
+            const uint64_t event_id{events[index].data.u64};
+
+            if      (event_id == LISTEN_EVENT_ID) { Accept_Connections(); }
+            else if (event_id == WORKER_EVENT_ID) { Handle_Bot_Moves(); }
+            else
+            {
+                // The connection may have been closed by an event read before this one
+                const auto found = _connections.find(event_id);
+                if (found == _connections.end()) { continue; }
+
+                S_Server_Connection & connection = *found->second;
+
+                // A reset client gives EPOLLOUT with EPOLLERR : once the write closes the connection, there is nothing left to read
+                if ((events[index].events & EPOLLOUT) && !Write_Connection(connection)) { continue; }
+                if (events[index].events & (EPOLLIN | EPOLLHUP | EPOLLERR))           { Read_Connection(connection); }
+            }
+        }
+    }
+
+    Stop_Workers();
+#else
+    (void)report_interval_s;
+#endif
+} // Run
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Stop(void) noexcept
+{
+    _quit = true;
+
+#if defined(__linux__)
+    // Wakes epoll_wait up : write is allowed in a signal handler
+    const uint64_t wake_up{1};
+    if (_event_descriptor >= 0) { (void)!::write(_event_descriptor, &wake_up, sizeof(wake_up)); }
+#endif
+} // Stop
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+S_Server_Statistics Game_Server::Get_Statistics(void) const noexcept
+{
+    const double elapsed_s{std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count()};
+
+    return S_Server_Statistics{_connections.size(), _matches, _moves, _bot_moves, elapsed_s, _matches / (elapsed_s + 1e-9),
+                               _validation_latencies.Get_Percentile_ns(50), _validation_latencies.Get_Percentile_ns(99)};
+} // Get_Statistics
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Accept_Connections(void) noexcept
+{
+#if defined(__linux__)
+    while (true)
+    {
+        const int descriptor{::accept4(_listen_descriptor, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)};
+
+        // No more connection waiting, or no descriptor left (the clients wait in the backlog)
+        if (descriptor < 0) { return; }
+
+        // Each command is a few bytes which must leave at once
+        const int no_delay{1};
+        ::setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+        std::unique_ptr<S_Server_Connection> connection{std::make_unique<S_Server_Connection>()};
+        connection->descriptor = descriptor;
+        connection->connection_id = _next_connection_id++;
+        connection->waiting_output = false;
+        connection->game.mode = E_Server_Game_Mode::NO_GAME;
+        connection->game.game_id = 0;
+        connection->game.color = E_Pawn_Color::BLACK;
+        connection->game.bot_depth = 0;
+        connection->game.waiting_bot = false;
+
+        struct epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = connection->connection_id;
+
+        if (::epoll_ctl(_epoll_descriptor, EPOLL_CTL_ADD, descriptor, &event) != 0)
+        {
+            ::close(descriptor);
+            continue;
+        }
+
+        _connections.emplace(connection->connection_id, std::move(connection));
+    }
+#endif
+} // Accept_Connections
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Game_Server::Read_Connection(S_Server_Connection & connection) noexcept
+{
+#if defined(__linux__)
+    std::array<char, SERVER_READ_SIZE> buffer;
+    const ssize_t count{::read(connection.descriptor, buffer.data(), buffer.size())};
+
+    if (count < 0 && (errno == EAGAIN || errno == EINTR)) { return true; }
+
+    // Closed by the client : its game is abandoned
+    if (count <= 0)
+    {
+        Close_Connection(connection.connection_id);
+        return false;
+    }
+
+    connection.input.append(buffer.data(), static_cast<std::size_t>(count));
+
+    // Every complete line is a command, the answers are written together once they are all handled
+    std::size_t line_start{0};
+
+    for (std::size_t line_end{connection.input.find('\n')}; line_end != std::string::npos; line_end = connection.input.find('\n', line_start))
+    {
+        std::string line{connection.input, line_start, line_end - line_start};
+        if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+
+        Handle_Line(connection, line);
+        line_start = line_end + 1;
+    }
+
+    connection.input.erase(0, line_start);
+
+    if (connection.input.size() > SERVER_MAX_LINE_SIZE)
+    {
+        Close_Connection(connection.connection_id);
+        return false;
+    }
+
+    return Write_Connection(connection);
+#else
+    (void)connection;
+    return false;
+#endif
+} // Read_Connection
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Game_Server::Write_Connection(S_Server_Connection & connection) noexcept
+{
+#if defined(__linux__)
+    std::size_t written{0};
+
+    while (written < connection.output.size())
+    {
+        const ssize_t count{::send(connection.descriptor, connection.output.data() + written, connection.output.size() - written, MSG_NOSIGNAL)};
+
+        if (count < 0)
+        {
+            if (errno == EINTR) { continue; }
+            if (errno == EAGAIN) { break; }
+
+            Close_Connection(connection.connection_id);
+            return false;
+        }
+
+        written += static_cast<std::size_t>(count);
+    }
+
+    connection.output.erase(0, written);
+
+    // The socket is full : the rest is written when it can take more
+    const bool waiting_output{!connection.output.empty()};
+
+    if (waiting_output != connection.waiting_output)
+    {
+        struct epoll_event event{};
+        event.events = waiting_output ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+        event.data.u64 = connection.connection_id;
+
+        ::epoll_ctl(_epoll_descriptor, EPOLL_CTL_MOD, connection.descriptor, &event);
+        connection.waiting_output = waiting_output;
+    }
+
+    return true;
+#else
+    (void)connection;
+    return false;
+#endif
+} // Write_Connection
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Close_Connection(const uint64_t connection_id) noexcept
+{
+#if defined(__linux__)
+    const auto found = _connections.find(connection_id);
+    if (found == _connections.end()) { return; }
+
+    // Closing the descriptor removes it from epoll
+    ::close(found->second->descriptor);
+    _connections.erase(found);
+#else
+    (void)connection_id;
+#endif
+} // Close_Connection
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Handle_Line(S_Server_Connection & connection, const std::string & line) noexcept
+{
+    std::istringstream words{line};
+    std::string command;
+    std::string argument;
+
+    words >> command >> argument;
+    std::transform(command.begin(), command.end(), command.begin(), [](const char character) { return static_cast<char>(std::toupper(static_cast<unsigned char>(character))); });
+    std::transform(argument.begin(), argument.end(), argument.begin(), [](const char character) { return static_cast<char>(std::toupper(static_cast<unsigned char>(character))); });
+
+    S_Server_Game & game = connection.game;
+
+    if (command == "MOVE")
+    {
+        Handle_Move(connection, argument);
+    }
+    else if (command == "NEW")
+    {
+        if (game.mode != E_Server_Game_Mode::NO_GAME) { Send(connection, "ERR game in progress\n"); return; }
+
+        unsigned int depth{0};
+        words >> depth;
+
+        if      (argument == "HUMANS" || argument.empty())  { game.mode = E_Server_Game_Mode::HUMANS; }
+        else if (argument == "BOT")                         { game.mode = E_Server_Game_Mode::BOT; }
+        else if (argument == "BOTS")                        { game.mode = E_Server_Game_Mode::BOTS; }
+        else                                                { Send(connection, "ERR unknown mode\n"); return; }
+
+        game.game_id = _next_game_id++;
+        game.othellier.Reset_Othellier();
+        game.color = E_Pawn_Color::BLACK;
+        game.bot_depth = std::max(1U, std::min(depth, static_cast<unsigned int>(SERVER_MAX_BOT_DEPTH)));
+        game.waiting_bot = false;
+
+        Send(connection, "GAME " + std::to_string(game.game_id) + "\n");
+        Next_Turn(connection);
+    }
+    else if (command == "QUIT")
+    {
+        if (game.mode == E_Server_Game_Mode::NO_GAME) { Send(connection, "ERR no game\n"); return; }
+
+        // A bot move still searched for this game will be dropped : its game id is not the one of the connection any more
+        game.mode = E_Server_Game_Mode::NO_GAME;
+        game.game_id = 0;
+        Send(connection, "END QUIT\n");
+    }
+    else if (command == "STATS")
+    {
+        Send(connection, Format_Statistics() + "\n");
+    }
+    else if (!command.empty())
+    {
+        Send(connection, "ERR unknown command\n");
+    }
+} // Handle_Line
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Handle_Move(S_Server_Connection & connection, const std::string & argument) noexcept
+{
+    S_Server_Game & game = connection.game;
+
+    // Validation latency : from the command to the move played on the othellier of the game
+    const auto start = std::chrono::steady_clock::now();
+
+    const bool client_turn{game.mode == E_Server_Game_Mode::HUMANS || (game.mode == E_Server_Game_Mode::BOT && game.color == E_Pawn_Color::BLACK)};
+
+    if (game.mode == E_Server_Game_Mode::NO_GAME)   { Send(connection, "ERR no game\n"); return; }
+    if (!client_turn || game.waiting_bot)           { Send(connection, "ERR not your turn\n"); return; }
+
+    const unsigned int square{Parse_Square(argument)};
+
+    if (square >= NUMBER_SQUARES || !(game.othellier.Generate_Legal_Moves(game.color) & Bitboard::Square_Bit(square)))
+    {
+        Send(connection, "ERR illegal move\n");
+        return;
+    }
+
+    game.othellier.Make_Move(square, game.color);
+
+    _validation_latencies.Add(static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+    ++_moves;
+
+    Send(connection, std::string("PLAYED ") + Color_Letter(game.color) + " " + Format_Square(square) + "\n");
+
+    game.color = Get_Opponent_Color(game.color);
+    Next_Turn(connection);
+} // Handle_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Next_Turn(S_Server_Connection & connection) noexcept
+{
+    S_Server_Game & game = connection.game;
+
+    // A color without move passes, the game ends when both have none
+    if (!game.othellier.Generate_Legal_Moves(game.color))
+    {
+        if (!game.othellier.Generate_Legal_Moves(Get_Opponent_Color(game.color)))
+        {
+            const auto pawns = game.othellier.Count_All_Pawns();
+
+            Send(connection, "END " + std::to_string(pawns.first) + " " + std::to_string(pawns.second) + "\n");
+            game.mode = E_Server_Game_Mode::NO_GAME;
+            game.game_id = 0;
+            ++_matches;
+            return;
+        }
+
+        Send(connection, std::string("PASS ") + Color_Letter(game.color) + "\n");
+        game.color = Get_Opponent_Color(game.color);
+    }
+
+    const bool bot_turn{game.mode == E_Server_Game_Mode::BOTS || (game.mode == E_Server_Game_Mode::BOT && game.color == E_Pawn_Color::WHITE)};
+
+    if (!bot_turn)
+    {
+        Send(connection, std::string("TURN ") + Color_Letter(game.color) + "\n");
+        return;
+    }
+
+    // The search takes milliseconds : a worker plays it, the event loop goes on with the other connections
+    game.waiting_bot = true;
+
+    {
+        std::lock_guard<std::mutex> lock(_jobs_mutex);
+        _jobs.push_back(S_Bot_Job{connection.connection_id, game.game_id, game.othellier.Get_Pawns(E_Pawn_Color::BLACK), game.othellier.Get_Pawns(E_Pawn_Color::WHITE),
+                                  game.color, game.bot_depth, NO_MOVE});
+    }
+
+    _jobs_condition.notify_one();
+} // Next_Turn
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Handle_Bot_Moves(void) noexcept
+{
+#if defined(__linux__)
+    uint64_t counter;
+    (void)!::read(_event_descriptor, &counter, sizeof(counter));
+#endif
+
+    std::vector<S_Bot_Job> results;
+
+    {
+        std::lock_guard<std::mutex> lock(_jobs_mutex);
+        results.swap(_results);
+    }
+
+    for (const S_Bot_Job & result : results)
+    {
+        // The connection was closed, or its game ended, while the worker searched
+        const auto found = _connections.find(result.connection_id);
+        if (found == _connections.end()) { continue; }
+
+        S_Server_Connection & connection = *found->second;
+        S_Server_Game & game = connection.game;
+
+        if (game.game_id != result.game_id || !game.waiting_bot || result.move >= NUMBER_SQUARES) { continue; }
+
+        game.waiting_bot = false;
+        game.othellier.Make_Move(result.move, game.color);
+        ++_bot_moves;
+
+        Send(connection, std::string("PLAYED ") + Color_Letter(game.color) + " " + Format_Square(result.move) + "\n");
+
+        game.color = Get_Opponent_Color(game.color);
+        Next_Turn(connection);
+        Write_Connection(connection);
+    }
+} // Handle_Bot_Moves
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Send(S_Server_Connection & connection, const std::string & text) noexcept
+{
+    // Written by Write_Connection, once every command received together has been handled
+    connection.output += text;
+} // Send
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::string Game_Server::Format_Statistics(void) const noexcept
+{
+    const S_Server_Statistics statistics{Get_Statistics()};
+    char text[256];
+
+    std::snprintf(text, sizeof(text), "STATS %.1f s : %llu connections, %llu matches (%.1f matches/s), %llu moves, %llu bot moves, move validation p50 %.2f us p99 %.2f us",
+                  statistics.elapsed_s, statistics.connections, statistics.matches, statistics.matches_per_second, statistics.moves, statistics.bot_moves,
+                  statistics.validation_p50_ns / 1000.0, statistics.validation_p99_ns / 1000.0);
+
+    return text;
+} // Format_Statistics
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Worker_Loop(void) noexcept
+{
+    // One search thread per worker : the games are the parallelism
+    Search_Engine search_engine{1, SERVER_BOT_HASH_SIZE_MB};
+    Bitboard_Othellier othellier;
+
+    while (true)
+    {
+        S_Bot_Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(_jobs_mutex);
+            _jobs_condition.wait(lock, [this]() { return _stop_workers || !_jobs.empty(); });
+
+            if (_stop_workers) { return; }
+
+            job = _jobs.front();
+            _jobs.pop_front();
+        }
+
+        othellier.Set_Othellier(job.black_pawns, job.white_pawns);
+        job.move = search_engine.Search(othellier, job.color, NO_TIME_LIMIT_MS, job.depth).best_move;
+
+        {
+            std::lock_guard<std::mutex> lock(_jobs_mutex);
+            _results.push_back(job);
+        }
+
+#if defined(__linux__)
+        const uint64_t wake_up{1};
+        (void)!::write(_event_descriptor, &wake_up, sizeof(wake_up));
+#endif
+    }
+} // Worker_Loop
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Game_Server::Stop_Workers(void) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(_jobs_mutex);
+        _stop_workers = true;
+        _jobs.clear();
+    }
+
+    _jobs_condition.notify_all();
+
+    for (std::thread & worker : _workers) { worker.join(); }
+    _workers.clear();
+} // Stop_Workers
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Server Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+bool Parse_Server_Address(const std::string & text, const bool server, S_Server_Address & address) noexcept
+{
+    address = S_Server_Address{false, "", server ? "0.0.0.0" : "127.0.0.1", 0};
+
+    if (text.compare(0, 5, "unix:") == 0)
+    {
+        address.unix_socket = true;
+        address.path = text.substr(5);
+        return !address.path.empty();
+    }
+
+    if (text.compare(0, 4, "tcp:") != 0) { return false; }
+
+    const std::string host_port{text.substr(4)};
+    const std::size_t separator{host_port.rfind(':')};
+    const std::string port{separator == std::string::npos ? host_port : host_port.substr(separator + 1)};
+
+    if (separator != std::string::npos) { address.host = host_port.substr(0, separator); }
+    if (port.empty() || port.size() > 5 || !std::all_of(port.begin(), port.end(), [](const char character) { return character >= '0' && character <= '9'; })) { return false; }
+
+    const unsigned long number{std::strtoul(port.c_str(), nullptr, 10)};
+    address.port = static_cast<uint16_t>(number);
+
+    return number > 0 && number <= 65535;
+} // Parse_Server_Address
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Connect_to_Server(const S_Server_Address & address) noexcept
+{
+#if defined(__linux__)
+    const int descriptor{::socket(address.unix_socket ? AF_UNIX : AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    if (descriptor < 0) { return -1; }
+
+    int result{-1};
+
+    if (address.unix_socket)
+    {
+        struct sockaddr_un socket_address{};
+        socket_address.sun_family = AF_UNIX;
+
+        if (address.path.size() < sizeof(socket_address.sun_path))
+        {
+            std::copy(address.path.begin(), address.path.end(), socket_address.sun_path);
+            result = ::connect(descriptor, reinterpret_cast<const struct sockaddr *>(&socket_address), sizeof(socket_address));
+        }
+    }
+    else
+    {
+        struct sockaddr_in socket_address{};
+        socket_address.sin_family = AF_INET;
+        socket_address.sin_port = htons(address.port);
+
+        if (::inet_pton(AF_INET, address.host.c_str(), &socket_address.sin_addr) == 1)
+        {
+            result = ::connect(descriptor, reinterpret_cast<const struct sockaddr *>(&socket_address), sizeof(socket_address));
+
+            const int no_delay{1};
+            ::setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+        }
+    }
+
+    if (result != 0)
+    {
+        ::close(descriptor);
+        return -1;
+    }
+
+    return descriptor;
+#else
+    (void)address;
+    return -1;
+#endif
+} // Connect_to_Server
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::string Format_Square(const unsigned int square)
+{
+    return std::string{static_cast<char>('a' + square % NUMBER_COLUMNS), static_cast<char>('1' + square / NUMBER_COLUMNS)};
+} // Format_Square
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Parse_Square(const std::string & text) noexcept
+{
+    S_Move_Command command;
+
+    // Same notation as the players of the terminal
+    if (!Parse_Move_Command(text, command) || command.command != E_Game_Command::NO_COMMAND) { return NUMBER_SQUARES; }
+
+    return (command.line - 1) * NUMBER_COLUMNS + (command.column - 1);
+} // Parse_Square
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,140 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "input.h"
+#include "othellier.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+
+#if defined(_WIN32)
+#include <iostream>
+#else
+#include <cerrno>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Input_Reader::Input_Reader(const int descriptor) : _descriptor(descriptor), _buffer(), _size(0), _closed(false)
+{
+} // Input_Reader
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Input_Reader::~Input_Reader()
+{
+} // ~Input_Reader
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+E_Input_Status Input_Reader::Wait_Line(std::string & line, const int timeout_ms) noexcept
+{
+#if defined(_WIN32)
+    (void)timeout_ms;
+    if (!std::getline(std::cin, line)) { return E_Input_Status::CLOSED; }
+    if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+    return E_Input_Status::LINE;
+#else
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+    while (!Extract_Line(line))
+    {
+        if (_closed) { return E_Input_Status::CLOSED; }
+
+        int remaining_ms{timeout_ms};
+
+        if (timeout_ms >= 0)
+        {
+            remaining_ms = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count());
+            if (remaining_ms < 0) { remaining_ms = 0; }
+        }
+
+        struct pollfd input{_descriptor, POLLIN, 0};
+        const int ready{::poll(&input, 1, remaining_ms)};
+
+        if (ready < 0 && errno == EINTR) { continue; }
+        if (ready == 0) { return E_Input_Status::TIMEOUT; }
+
+        const ssize_t count{ready < 0 ? -1 : ::read(_descriptor, _buffer.data() + _size, _buffer.size() - _size)};
+
+        if (count < 0 && errno == EINTR) { continue; }
+
+        // End of the input, or an error which won't go away : the last line is read even without its end of line
+        if (count <= 0) { _closed = true; }
+        else            { _size += static_cast<std::size_t>(count); }
+    }
+
+    return E_Input_Status::LINE;
+#endif
+} // Wait_Line
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Input_Reader::Get_Descriptor(void) const noexcept
+{
+    return _descriptor;
+} // Get_Descriptor
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Input_Reader::Extract_Line(std::string & line) noexcept
+{
+    const auto end = _buffer.begin() + static_cast<std::ptrdiff_t>(_size);
+    auto line_end = std::find(_buffer.begin(), end, '\n');
+
+    // A full buffer without end of line is a line, and the last bytes once the input is closed
+    if (line_end == end && _size < _buffer.size() && !(_closed && _size > 0)) { return false; }
+
+    line.assign(_buffer.begin(), line_end);
+    if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+
+    if (line_end != end) { ++line_end; }
+    _size = static_cast<std::size_t>(std::copy(line_end, end, _buffer.begin()) - _buffer.begin());
+
+    return true;
+} // Extract_Line
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Input Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+bool Parse_Move_Command(const std::string & text, S_Move_Command & command) noexcept
+{
+    // One token : the spaces around are ignored, not the ones inside
+    const auto first = std::find_if_not(text.begin(), text.end(), [](const char character) { return std::isspace(static_cast<unsigned char>(character)); });
+    const auto last  = std::find_if_not(text.rbegin(), text.rend(), [](const char character) { return std::isspace(static_cast<unsigned char>(character)); }).base();
+
+    std::string token{first < last ? std::string(first, last) : std::string()};
+    std::transform(token.begin(), token.end(), token.begin(), [](const char character) { return static_cast<char>(std::tolower(static_cast<unsigned char>(character))); });
+
+    command = S_Move_Command{E_Game_Command::NO_COMMAND, 0, 0};
+
+    if (token == "pass") { command.command = E_Game_Command::PASS_TURN; return true; }
+    if (token == "quit") { command.command = E_Game_Command::QUIT_GAME; return true; }
+
+    // Column letter then row number, as the tournaments write the moves
+    if (token.size() == 2 && token[0] >= 'a' && token[0] < static_cast<char>('a' + NUMBER_COLUMNS) && token[1] >= '1' && token[1] < static_cast<char>('1' + NUMBER_ROWS))
+    {
+        command.column = static_cast<unsigned int>(token[0] - 'a') + 1;
+        command.line   = static_cast<unsigned int>(token[1] - '1') + 1;
+        return true;
+    }
+
+    return false;
+} // Parse_Move_Command
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,155 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "mapped_file.h"
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#if defined(_WIN32)
+Mapped_File::Mapped_File() : _data(nullptr), _size(0), _open(false), _file(INVALID_HANDLE_VALUE), _mapping(nullptr)
+#else
+Mapped_File::Mapped_File() : _data(nullptr), _size(0), _open(false)
+#endif
+{
+} // Mapped_File
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Mapped_File::~Mapped_File()
+{
+    Close();
+} // ~Mapped_File
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Mapped_File::Open(const std::string & path) noexcept
+{
+    Close();
+
+#if defined(_WIN32)
+    _file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (_file == INVALID_HANDLE_VALUE) { return false; }
+
+    LARGE_INTEGER size;
+
+    if (!GetFileSizeEx(_file, &size))
+    {
+        Close();
+        return false;
+    }
+
+    _size = static_cast<std::size_t>(size.QuadPart);
+
+    // A file of 0 byte can't be mapped : it is open, without data
+    if (_size > 0)
+    {
+        _mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        _data = _mapping ? static_cast<const uint8_t *>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+
+        if (!_data)
+        {
+            Close();
+            return false;
+        }
+    }
+#else
+    const int file{::open(path.c_str(), O_RDONLY)};
+    if (file < 0) { return false; }
+
+    struct stat status;
+
+    if (::fstat(file, &status) != 0)
+    {
+        ::close(file);
+        return false;
+    }
+
+    _size = static_cast<std::size_t>(status.st_size);
+
+    // A file of 0 byte can't be mapped : it is open, without data
+    if (_size > 0)
+    {
+        void * data{::mmap(nullptr, _size, PROT_READ, MAP_SHARED, file, 0)};
+
+        if (data == MAP_FAILED)
+        {
+            ::close(file);
+            _size = 0;
+            return false;
+        }
+
+        _data = static_cast<const uint8_t *>(data);
+    }
+
+    // The mapping stays valid once the file is closed
+    ::close(file);
+#endif
+
+    _open = true;
+
+    return true;
+} // Open
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Mapped_File::Close(void) noexcept
+{
+#if defined(_WIN32)
+    if (_data)                          { UnmapViewOfFile(_data); }
+    if (_mapping)                       { CloseHandle(_mapping); }
+    if (_file != INVALID_HANDLE_VALUE)  { CloseHandle(_file); }
+
+    _mapping = nullptr;
+    _file = INVALID_HANDLE_VALUE;
+#else
+    if (_data) { ::munmap(const_cast<uint8_t *>(_data), _size); }
+#endif
+
+    _data = nullptr;
+    _size = 0;
+    _open = false;
+} // Close
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Mapped_File::Is_Open(void) const noexcept
+{
+    return _open;
+} // Is_Open
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const uint8_t * Mapped_File::Get_Data(void) const noexcept
+{
+    return _data;
+} // Get_Data
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Mapped_File::Get_Size(void) const noexcept
+{
+    return _size;
+} // Get_Size
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
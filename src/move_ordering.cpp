@@ -0,0 +1,160 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "move_ordering.h"
+
+#include <utility>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define HASH_MOVE_PRIORITY      (1U << 31)
+#define KILLER_PRIORITY         (1U << 30)  // Minus the index of the killer : the most recent one first
+#define HISTORY_SHIFT           4           // The history is scaled over the square priorities, which only break its ties
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Variables */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Corners first, then the edges and the center, the slots which give a corner away (next to it on the edge, and diagonally) last
+static const std::array<uint8_t, NUMBER_SQUARES> square_priorities
+{{
+    15,  3, 13, 11, 11, 13,  3, 15,
+     3,  0,  5,  6,  6,  5,  0,  3,
+    13,  5, 12,  9,  9, 12,  5, 13,
+    11,  6,  9,  0,  0,  9,  6, 11,
+    11,  6,  9,  0,  0,  9,  6, 11,
+    13,  5, 12,  9,  9, 12,  5, 13,
+     3,  0,  5,  6,  6,  5,  0,  3,
+    15,  3, 13, 11, 11, 13,  3, 15
+}};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Move_Ordering::Move_Ordering() : _settings{true, true, true, true}
+{
+    Clear();
+} // Move_Ordering
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Move_Ordering::~Move_Ordering()
+{
+} // ~Move_Ordering
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Move_Ordering::Set_Settings(const S_Move_Ordering_Settings & settings) noexcept
+{
+    _settings = settings;
+} // Set_Settings
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Move_Ordering::Clear(void) noexcept
+{
+    for (auto & killers : _killers) { killers.fill(NUMBER_SQUARES); }
+    for (auto & history : _history) { history.fill(0); }
+} // Clear
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Move_Ordering::New_Search(void) noexcept
+{
+    for (auto & history : _history)
+    {
+        for (uint32_t & counter : history) { counter /= 2; }
+    }
+} // New_Search
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Move_Ordering::Order_Moves(const uint64_t moves, const unsigned int hash_move, const unsigned int ply, const E_Pawn_Color color,
+                                        std::array<uint8_t, NUMBER_SQUARES> & ordered_moves) const noexcept
+{
+    const std::array<uint32_t, NUMBER_SQUARES> & history = _history[color == E_Pawn_Color::BLACK ? 0 : 1];
+    const std::array<uint8_t, NUMBER_KILLERS> & killers = _killers[ply < NUMBER_SQUARES ? ply : NUMBER_SQUARES];
+    std::array<uint32_t, NUMBER_SQUARES> priorities;
+    unsigned int number_of_moves{0};
+
+    for (uint64_t remaining{moves}; remaining; remaining &= remaining - 1)
+    {
+        const unsigned int move{Bitboard::First_Square(remaining)};
+        uint32_t priority{0};
+
+        if (_settings.hash_move && move == hash_move) { priority = HASH_MOVE_PRIORITY; }
+        else
+        {
+            for (unsigned int killer{0}; killer < NUMBER_KILLERS && priority == 0; ++killer)
+            {
+                if (_settings.killers && killers[killer] == move) { priority = KILLER_PRIORITY - killer; }
+            }
+
+            if (priority == 0)
+            {
+                if (_settings.history)              { priority += history[move] << HISTORY_SHIFT; }
+                if (_settings.square_priorities)    { priority += square_priorities[move]; }
+            }
+        }
+
+        // Insertion sort : a node has about 10 moves - equal priorities keep the order of the squares
+        unsigned int index{number_of_moves++};
+
+        for (; index > 0 && priorities[index - 1] < priority; --index)
+        {
+            priorities[index] = priorities[index - 1];
+            ordered_moves[index] = ordered_moves[index - 1];
+        }
+
+        priorities[index] = priority;
+        ordered_moves[index] = static_cast<uint8_t>(move);
+    }
+
+    return number_of_moves;
+} // Order_Moves
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Move_Ordering::Update(const unsigned int move, const unsigned int ply, const unsigned int depth, const E_Pawn_Color color) noexcept
+{
+    std::array<uint8_t, NUMBER_KILLERS> & killers = _killers[ply < NUMBER_SQUARES ? ply : NUMBER_SQUARES];
+
+    // The new killer goes first, the others move down over it (or over the last one)
+    unsigned int last{NUMBER_KILLERS - 1};
+
+    for (unsigned int killer{0}; killer < NUMBER_KILLERS; ++killer)
+    {
+        if (killers[killer] == move) { last = killer; break; }
+    }
+
+    for (unsigned int killer{last}; killer > 0; --killer) { killers[killer] = killers[killer - 1]; }
+    killers[0] = static_cast<uint8_t>(move);
+
+    std::array<uint32_t, NUMBER_SQUARES> & history = _history[color == E_Pawn_Color::BLACK ? 0 : 1];
+    history[move] += depth * depth;
+
+    if (history[move] > HISTORY_LIMIT)
+    {
+        for (auto & color_history : _history)
+        {
+            for (uint32_t & counter : color_history) { counter /= 2; }
+        }
+    }
+} // Update
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,199 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "opening_book.h"
+#include "symmetry.h"
+#include "zobrist.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define BOOK_MAGIC          "OTBK"
+#define MAGIC_SIZE          4
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static void Write_Little_Endian(uint8_t * data, const uint64_t value, const unsigned int number_of_bytes) noexcept
+{
+    for (unsigned int byte{0}; byte < number_of_bytes; ++byte) { data[byte] = static_cast<uint8_t>(value >> (8 * byte)); }
+} // Write_Little_Endian
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+static uint64_t Read_Little_Endian(const uint8_t * data, const unsigned int number_of_bytes) noexcept
+{
+    uint64_t value{0};
+
+    for (unsigned int byte{0}; byte < number_of_bytes; ++byte) { value |= static_cast<uint64_t>(data[byte]) << (8 * byte); }
+
+    return value;
+} // Read_Little_Endian
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Opening Book Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+uint64_t Get_Book_Key(const uint64_t player, const uint64_t opponent, unsigned int & transform) noexcept
+{
+    const S_Canonical_Position canonical{Bitboard::Canonicalize(player, opponent)};
+
+    transform = canonical.transform;
+
+    return Compute_Hash_Key(canonical.player, canonical.opponent);
+} // Get_Book_Key
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Write_Opening_Book(const std::string & path, std::vector<S_Book_Entry> entries) noexcept
+{
+    // Stable : of the entries with the same key, the first one given stays first and is the one unique keeps
+    std::stable_sort(entries.begin(), entries.end(), [](const S_Book_Entry & left, const S_Book_Entry & right) { return left.key < right.key; });
+    entries.erase(std::unique(entries.begin(), entries.end(), [](const S_Book_Entry & left, const S_Book_Entry & right) { return left.key == right.key; }), entries.end());
+
+    std::FILE * file{std::fopen(path.c_str(), "wb")};
+    if (!file) { return false; }
+
+    uint8_t header[BOOK_FILE_HEADER_SIZE]{};
+
+    std::memcpy(header, BOOK_MAGIC, MAGIC_SIZE);
+    header[MAGIC_SIZE] = OPENING_BOOK_VERSION;
+    Write_Little_Endian(header + 8, entries.size(), 8);
+
+    bool written{std::fwrite(header, 1, BOOK_FILE_HEADER_SIZE, file) == BOOK_FILE_HEADER_SIZE};
+
+    for (const S_Book_Entry & entry : entries)
+    {
+        if (!written) { break; }
+
+        uint8_t data[BOOK_ENTRY_SIZE]{};
+
+        Write_Little_Endian(data, entry.key, 8);
+        Write_Little_Endian(data + 8, static_cast<uint32_t>(entry.score), 4);
+        data[12] = static_cast<uint8_t>(entry.move);
+        data[13] = static_cast<uint8_t>(entry.depth);
+
+        written = std::fwrite(data, 1, BOOK_ENTRY_SIZE, file) == BOOK_ENTRY_SIZE;
+    }
+
+    return std::fclose(file) == 0 && written;
+} // Write_Opening_Book
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Opening_Book::Opening_Book() : _file(), _number_of_entries(0)
+{
+} // Opening_Book
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Opening_Book::~Opening_Book()
+{
+    Close();
+} // ~Opening_Book
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Opening_Book::Open(const std::string & path) noexcept
+{
+    Close();
+
+    if (!_file.Open(path)) { return false; }
+
+    const uint8_t * data{_file.Get_Data()};
+    const std::size_t size{_file.Get_Size()};
+
+    if (size < BOOK_FILE_HEADER_SIZE || std::memcmp(data, BOOK_MAGIC, MAGIC_SIZE) != 0 || data[MAGIC_SIZE] != OPENING_BOOK_VERSION
+        || Read_Little_Endian(data + 8, 8) != (size - BOOK_FILE_HEADER_SIZE) / BOOK_ENTRY_SIZE || (size - BOOK_FILE_HEADER_SIZE) % BOOK_ENTRY_SIZE != 0)
+    {
+        Close();
+        return false;
+    }
+
+    _number_of_entries = (size - BOOK_FILE_HEADER_SIZE) / BOOK_ENTRY_SIZE;
+
+    return true;
+} // Open
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Opening_Book::Close(void) noexcept
+{
+    _file.Close();
+    _number_of_entries = 0;
+} // Close
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Opening_Book::Is_Open(void) const noexcept
+{
+    return _file.Is_Open();
+} // Is_Open
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Opening_Book::Get_Number_of_Entries(void) const noexcept
+{
+    return _number_of_entries;
+} // Get_Number_of_Entries
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Opening_Book::Probe(const uint64_t player, const uint64_t opponent, S_Book_Entry & entry) const noexcept
+{
+    if (_number_of_entries == 0) { return false; }
+
+    unsigned int transform{0};
+    const uint64_t key{Get_Book_Key(player, opponent, transform)};
+    const uint8_t * entries{_file.Get_Data() + BOOK_FILE_HEADER_SIZE};
+
+    // Binary search : about 20 entries read for a million positions, only their pages are loaded
+    std::size_t first{0};
+    std::size_t last{_number_of_entries};
+
+    while (first < last)
+    {
+        const std::size_t middle{first + (last - first) / 2};
+
+        if (Read_Little_Endian(entries + middle * BOOK_ENTRY_SIZE, 8) < key)   { first = middle + 1; }
+        else                                                                    { last = middle; }
+    }
+
+    if (first == _number_of_entries) { return false; }
+
+    const uint8_t * data{entries + first * BOOK_ENTRY_SIZE};
+
+    if (Read_Little_Endian(data, 8) != key || data[12] >= NUMBER_SQUARES) { return false; }
+
+    entry.key   = key;
+    entry.score = static_cast<int>(static_cast<uint32_t>(Read_Little_Endian(data + 8, 4)));
+    entry.move  = Bitboard::Untransform_Square(data[12], transform);
+    entry.depth = data[13];
+
+    return true;
+} // Probe
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -6,10 +6,13 @@
 #include "othellier.h"
 #include "configuration.h"
 #include "templates.h"
+#include "bitboard.h"
+#include "renderer.h"
 
 #include <utility>
 #include <iostream>
-#include <vector>
+#include <array>
+#include <cstddef>
 #include <string>
 
 /********************************************************************************************************************************************************************/
@@ -31,7 +34,6 @@ bool Security_Check_Failed(const unsigned int x, const unsigned int y)
 Othellier::Othellier()
 {
     Reset_Othellier();
-    Draw_Othellier();
 } // Othellier
 
 /********************************************************************************************************************************************************************/
@@ -51,9 +53,26 @@ bool Othellier::Place_Pawn(const unsigned int position_x, const unsigned int pos
         const unsigned int internal_position_x{position_x - 1};
         const unsigned int internal_position_y{position_y - 1};
 
-        if (Switch_Possible_Opponent_Pawns(internal_position_x, internal_position_y, pawn))
+        const unsigned int switched_pawns{Switch_Possible_Opponent_Pawns(internal_position_x, internal_position_y, pawn)};
+
+        if (switched_pawns > 0)
         {
             _othellier[internal_position_x][internal_position_y].Occupy_Slot(pawn);
+
+            // Update the counters : the pawn placed and the switched ones change of owner
+            ++_number_of_slots_occupied;
+
+            if (pawn.Get_Color() == E_Pawn_Color::BLACK)
+            {
+                _number_of_black_pawns += switched_pawns + 1;
+                _number_of_white_pawns -= switched_pawns;
+            }
+            else
+            {
+                _number_of_white_pawns += switched_pawns + 1;
+                _number_of_black_pawns -= switched_pawns;
+            }
+
             return true;
         }
     }
@@ -79,27 +98,27 @@ bool Othellier::Check_Pawn_Position_is_Valid(const unsigned int position_x, cons
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Othellier::Switch_Possible_Opponent_Pawns(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
+unsigned int Othellier::Switch_Possible_Opponent_Pawns(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
 {
-    bool result{false};
+    unsigned int result{0}; // Number of opponent pawns switched
 
-    // Overflow security due to what happen during the several try to switch -> it is easier to regroup this at this level and not everywhere
-    const unsigned int x_minus_1{position_x == MIN_INDEX ?          position_x : position_x - 1};
-    const unsigned int x_plus_1 {position_x == NUMBER_ROWS - 1 ?    position_x : position_x + 1};
-    const unsigned int y_minus_1{position_y == MIN_INDEX ?          position_y : position_y - 1};
-    const unsigned int y_plus_1 {position_y == NUMBER_COLUMNS - 1 ? position_y : position_y + 1};
+    // Neighbour slots - on the border, 0 - 1 wraps to the max unsigned int value and the direction loops stop right away
+    const unsigned int x_minus_1{position_x - 1};
+    const unsigned int x_plus_1 {position_x + 1};
+    const unsigned int y_minus_1{position_y - 1};
+    const unsigned int y_plus_1 {position_y + 1};
 
     // Normal directions
-    result |= Try_to_Switch_in_Up_Direction(position_x, y_minus_1, pawn);
-    result |= Try_to_Switch_in_Down_Direction(position_x, y_plus_1, pawn);
-    result |= Try_to_Switch_in_Left_Direction(x_minus_1, position_y, pawn);
-    result |= Try_to_Switch_in_Right_Direction(x_plus_1, position_y, pawn);
+    result += Try_to_Switch_in_Up_Direction(position_x, y_minus_1, pawn);
+    result += Try_to_Switch_in_Down_Direction(position_x, y_plus_1, pawn);
+    result += Try_to_Switch_in_Left_Direction(x_minus_1, position_y, pawn);
+    result += Try_to_Switch_in_Right_Direction(x_plus_1, position_y, pawn);
 
     // Diagonal directions
-    result |= Try_to_Switch_in_Up_Left_Direction(x_minus_1, y_minus_1, pawn);
-    result |= Try_to_Switch_in_Up_Right_Direction(x_plus_1, y_minus_1, pawn);
-    result |= Try_to_Switch_in_Down_Left_Direction(x_minus_1, y_plus_1, pawn);
-    result |= Try_to_Switch_in_Down_Right_Direction(x_plus_1, y_plus_1, pawn);
+    result += Try_to_Switch_in_Up_Left_Direction(x_minus_1, y_minus_1, pawn);
+    result += Try_to_Switch_in_Up_Right_Direction(x_plus_1, y_minus_1, pawn);
+    result += Try_to_Switch_in_Down_Left_Direction(x_minus_1, y_plus_1, pawn);
+    result += Try_to_Switch_in_Down_Right_Direction(x_plus_1, y_plus_1, pawn);
 
     return result;
 } // Switch_Possible_Opponent_Pawns
@@ -107,12 +126,13 @@ bool Othellier::Switch_Possible_Opponent_Pawns(const unsigned int position_x, co
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Othellier::Try_to_Switch_in_Up_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
+unsigned int Othellier::Try_to_Switch_in_Up_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
 {
     bool must_return_slot{false};
-    std::vector<Slot *> slots; // Addresses of the slots
+    std::array<Slot *, MAX_SWITCHED_PAWNS> slots; // Addresses of the slots - fixed capacity, no heap allocation
+    unsigned int number_of_slots{0};
 
-    for (auto y{position_y}; y > MIN_INDEX; --y)
+    for (auto y{position_y}; y < NUMBER_COLUMNS; --y)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(position_x, y)) { break; }
@@ -133,28 +153,29 @@ bool Othellier::Try_to_Switch_in_Up_Direction(const unsigned int position_x, con
         // Opponent color
         else if (_othellier[position_x][y].Get_Pawn_Color() != pawn.Get_Color())
         {
-            slots.push_back( &_othellier[position_x][y] );
+            slots[number_of_slots++] = &_othellier[position_x][y];
         }
     }
 
     // Case where we must return the pawn on the slot
-    if (must_return_slot && !slots.empty())
+    if (must_return_slot && number_of_slots > 0)
     {
-        for (auto slot : slots) { slot->Return_Pawn(); }
-        return true;
+        for (unsigned int index{0}; index < number_of_slots; ++index) { slots[index]->Return_Pawn(); }
+        return number_of_slots;
     }
 
     // No actions
-    return false;
+    return 0;
 } // Try_to_Switch_in_Up_Direction
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Othellier::Try_to_Switch_in_Down_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
+unsigned int Othellier::Try_to_Switch_in_Down_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
 {
     bool must_return_slot{false};
-    std::vector<Slot *> slots; // Addresses of the slots
+    std::array<Slot *, MAX_SWITCHED_PAWNS> slots; // Addresses of the slots - fixed capacity, no heap allocation
+    unsigned int number_of_slots{0};
 
     for (auto y{position_y}; y < NUMBER_COLUMNS; ++y)
     {
@@ -177,30 +198,31 @@ bool Othellier::Try_to_Switch_in_Down_Direction(const unsigned int position_x, c
         // Opponent color
         else if (_othellier[position_x][y].Get_Pawn_Color() != pawn.Get_Color())
         {
-            slots.push_back( &_othellier[position_x][y] );
+            slots[number_of_slots++] = &_othellier[position_x][y];
         }
     }
 
     // Case where we must return the pawn on the slot
-    if (must_return_slot && !slots.empty())
+    if (must_return_slot && number_of_slots > 0)
     {
-        for (auto slot : slots) { slot->Return_Pawn(); }
-        return true;
+        for (unsigned int index{0}; index < number_of_slots; ++index) { slots[index]->Return_Pawn(); }
+        return number_of_slots;
     }
 
     // No actions
-    return false;
+    return 0;
 } // Try_to_Switch_in_Down_Direction
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Othellier::Try_to_Switch_in_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
+unsigned int Othellier::Try_to_Switch_in_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
 {
     bool must_return_slot{false};
-    std::vector<Slot *> slots; // Addresses of the slots
+    std::array<Slot *, MAX_SWITCHED_PAWNS> slots; // Addresses of the slots - fixed capacity, no heap allocation
+    unsigned int number_of_slots{0};
 
-    for (auto x{position_x}; x > MIN_INDEX; --x)
+    for (auto x{position_x}; x < NUMBER_ROWS; --x)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(x, position_y)) { break; }
@@ -221,28 +243,29 @@ bool Othellier::Try_to_Switch_in_Left_Direction(const unsigned int position_x, c
         // Opponent color
         else if (_othellier[x][position_y].Get_Pawn_Color() != pawn.Get_Color())
         {
-            slots.push_back( &_othellier[x][position_y] );
+            slots[number_of_slots++] = &_othellier[x][position_y];
         }
     }
 
     // Case where we must return the pawn on the slot
-    if (must_return_slot && !slots.empty())
+    if (must_return_slot && number_of_slots > 0)
     {
-        for (auto slot : slots) { slot->Return_Pawn(); }
-        return true;
+        for (unsigned int index{0}; index < number_of_slots; ++index) { slots[index]->Return_Pawn(); }
+        return number_of_slots;
     }
 
     // No actions
-    return false;
+    return 0;
 } // Try_to_Switch_in_Left_Direction
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Othellier::Try_to_Switch_in_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
+unsigned int Othellier::Try_to_Switch_in_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
 {
     bool must_return_slot{false};
-    std::vector<Slot *> slots; // Addresses of the slots
+    std::array<Slot *, MAX_SWITCHED_PAWNS> slots; // Addresses of the slots - fixed capacity, no heap allocation
+    unsigned int number_of_slots{0};
 
     for (auto x{position_x}; x < NUMBER_ROWS; ++x)
     {
@@ -265,33 +288,34 @@ bool Othellier::Try_to_Switch_in_Right_Direction(const unsigned int position_x,
         // Opponent color
         else if (_othellier[x][position_y].Get_Pawn_Color() != pawn.Get_Color())
         {
-            slots.push_back( &_othellier[x][position_y] );
+            slots[number_of_slots++] = &_othellier[x][position_y];
         }
     }
 
     // Case where we must return the pawn on the slot
-    if (must_return_slot && !slots.empty())
+    if (must_return_slot && number_of_slots > 0)
     {
-        for (auto slot : slots) { slot->Return_Pawn(); }
-        return true;
+        for (unsigned int index{0}; index < number_of_slots; ++index) { slots[index]->Return_Pawn(); }
+        return number_of_slots;
     }
 
     // No actions
-    return false;
+    return 0;
 } // Try_to_Switch_in_Right_Direction
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Othellier::Try_to_Switch_in_Up_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
+unsigned int Othellier::Try_to_Switch_in_Up_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
 {
     bool must_return_slot{false};
-    std::vector<Slot *> slots; // Addresses of the slots
+    std::array<Slot *, MAX_SWITCHED_PAWNS> slots; // Addresses of the slots - fixed capacity, no heap allocation
+    unsigned int number_of_slots{0};
 
     auto x{position_x};
     auto y{position_y};
 
-    for (; x > MIN_INDEX || y > MIN_INDEX; --x, --y)
+    for (; x < NUMBER_ROWS && y < NUMBER_COLUMNS; --x, --y)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(x, y)) { break; }
@@ -312,33 +336,34 @@ bool Othellier::Try_to_Switch_in_Up_Left_Direction(const unsigned int position_x
         // Opponent color
         else if (_othellier[x][y].Get_Pawn_Color() != pawn.Get_Color())
         {
-            slots.push_back( &_othellier[x][y] );
+            slots[number_of_slots++] = &_othellier[x][y];
         }
     }
 
     // Case where we must return the pawn on the slot
-    if (must_return_slot && !slots.empty())
+    if (must_return_slot && number_of_slots > 0)
     {
-        for (auto slot : slots) { slot->Return_Pawn(); }
-        return true;
+        for (unsigned int index{0}; index < number_of_slots; ++index) { slots[index]->Return_Pawn(); }
+        return number_of_slots;
     }
 
     // No actions
-    return false;
+    return 0;
 } // Try_to_Switch_in_Up_Left_Direction
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Othellier::Try_to_Switch_in_Up_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
+unsigned int Othellier::Try_to_Switch_in_Up_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
 {
     bool must_return_slot{false};
-    std::vector<Slot *> slots; // Addresses of the slots
+    std::array<Slot *, MAX_SWITCHED_PAWNS> slots; // Addresses of the slots - fixed capacity, no heap allocation
+    unsigned int number_of_slots{0};
 
     auto x{position_x};
     auto y{position_y};
 
-    for (; x < NUMBER_ROWS || y > MIN_INDEX; ++x, --y)
+    for (; x < NUMBER_ROWS && y < NUMBER_COLUMNS; ++x, --y)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(x, y)) { break; }
@@ -359,33 +384,34 @@ bool Othellier::Try_to_Switch_in_Up_Right_Direction(const unsigned int position_
         // Opponent color
         else if (_othellier[x][y].Get_Pawn_Color() != pawn.Get_Color())
         {
-            slots.push_back( &_othellier[x][y] );
+            slots[number_of_slots++] = &_othellier[x][y];
         }
     }
 
     // Case where we must return the pawn on the slot
-    if (must_return_slot && !slots.empty())
+    if (must_return_slot && number_of_slots > 0)
     {
-        for (auto slot : slots) { slot->Return_Pawn(); }
-        return true;
+        for (unsigned int index{0}; index < number_of_slots; ++index) { slots[index]->Return_Pawn(); }
+        return number_of_slots;
     }
 
     // No actions
-    return false;
+    return 0;
 } // Try_to_Switch_in_Up_Right_Direction
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Othellier::Try_to_Switch_in_Down_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
+unsigned int Othellier::Try_to_Switch_in_Down_Left_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
 {
     bool must_return_slot{false};
-    std::vector<Slot *> slots; // Addresses of the slots
+    std::array<Slot *, MAX_SWITCHED_PAWNS> slots; // Addresses of the slots - fixed capacity, no heap allocation
+    unsigned int number_of_slots{0};
 
     auto x{position_x};
     auto y{position_y};
 
-    for (; x > MIN_INDEX || y < NUMBER_COLUMNS; --x, ++y)
+    for (; x < NUMBER_ROWS && y < NUMBER_COLUMNS; --x, ++y)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(x, y)) { break; }
@@ -406,33 +432,34 @@ bool Othellier::Try_to_Switch_in_Down_Left_Direction(const unsigned int position
         // Opponent color
         else if (_othellier[x][y].Get_Pawn_Color() != pawn.Get_Color())
         {
-            slots.push_back( &_othellier[x][y] );
+            slots[number_of_slots++] = &_othellier[x][y];
         }
     }
 
     // Case where we must return the pawn on the slot
-    if (must_return_slot && !slots.empty())
+    if (must_return_slot && number_of_slots > 0)
     {
-        for (auto slot : slots) { slot->Return_Pawn(); }
-        return true;
+        for (unsigned int index{0}; index < number_of_slots; ++index) { slots[index]->Return_Pawn(); }
+        return number_of_slots;
     }
 
     // No actions
-    return false;
+    return 0;
 } // Try_to_Switch_in_Down_Left_Direction
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Othellier::Try_to_Switch_in_Down_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
+unsigned int Othellier::Try_to_Switch_in_Down_Right_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) noexcept
 {
     bool must_return_slot{false};
-    std::vector<Slot *> slots; // Addresses of the slots
+    std::array<Slot *, MAX_SWITCHED_PAWNS> slots; // Addresses of the slots - fixed capacity, no heap allocation
+    unsigned int number_of_slots{0};
 
     auto x{position_x};
     auto y{position_y};
 
-    for (; x < NUMBER_ROWS || y < NUMBER_COLUMNS; ++x, ++y)
+    for (; x < NUMBER_ROWS && y < NUMBER_COLUMNS; ++x, ++y)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(x, y)) { break; }
@@ -453,79 +480,90 @@ bool Othellier::Try_to_Switch_in_Down_Right_Direction(const unsigned int positio
         // Opponent color
         else if (_othellier[x][y].Get_Pawn_Color() != pawn.Get_Color())
         {
-            slots.push_back( &_othellier[x][y] );
+            slots[number_of_slots++] = &_othellier[x][y];
         }
     }
 
     // Case where we must return the pawn on the slot
-    if (must_return_slot && !slots.empty())
+    if (must_return_slot && number_of_slots > 0)
     {
-        for (auto slot : slots) { slot->Return_Pawn(); }
-        return true;
+        for (unsigned int index{0}; index < number_of_slots; ++index) { slots[index]->Return_Pawn(); }
+        return number_of_slots;
     }
 
     // No actions
-    return false;
+    return 0;
 } // Try_to_Switch_in_Down_Right_Direction
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Othellier::Can_Play(const Pawn & pawn) const noexcept
+uint64_t Othellier::Generate_Legal_Moves(const E_Pawn_Color color) const noexcept
 {
-    bool result{false};
-
-    // Check there is at least one pawn
-    /*bool no_more_pawn{false};
-    unsigned int i{0};
-    unsigned int j{0};
+    const Pawn pawn{color};
+    uint64_t legal_moves{0};
 
-    for (; i < NUMBER_ROWS && j < NUMBER_COLUMNS; ++i, ++j)
+    for (unsigned int position_x{MIN_INDEX}; position_x < NUMBER_ROWS; ++position_x)
     {
-        if (!_othellier[i][j].Is_Empty())
+        for (unsigned int position_y{MIN_INDEX}; position_y < NUMBER_COLUMNS; ++position_y)
         {
-            if (_othellier[i][j].Get_Pawn_Color() == pawn.Get_Color())
-            {
-                no_more_pawn = true;
-            }
+            if (Is_Legal_Move(position_x, position_y, pawn)) { legal_moves |= Bitboard::Square_Bit(position_y * NUMBER_COLUMNS + position_x); }
         }
     }
 
-    if (no_more_pawn)
-    {
-        return false;
-    }*/
+    return legal_moves;
+} // Generate_Legal_Moves
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
 
-    // Check possibilities to play
+bool Othellier::Can_Play(const Pawn & pawn) const noexcept
+{
+    // Same scan as Generate_Legal_Moves, but stops at the first slot where the pawn can be placed
     for (unsigned int position_x{MIN_INDEX}; position_x < NUMBER_ROWS; ++position_x)
     {
         for (unsigned int position_y{MIN_INDEX}; position_y < NUMBER_COLUMNS; ++position_y)
         {
-            // Normal directions
-            result |= Try_to_Play_in_Up_Direction(position_x, position_y, pawn);
-            result |= Try_to_Play_in_Down_Direction(position_x, position_y, pawn);
-            result |= Try_to_Play_in_Left_Direction(position_x, position_y, pawn);
-            result |= Try_to_Play_in_Right_Direction(position_x, position_y, pawn);
-
-            // Diagonal directions
-            result |= Try_to_Play_in_Up_Left_Direction(position_x, position_y, pawn);
-            result |= Try_to_Play_in_Up_Right_Direction(position_x, position_y, pawn);
-            result |= Try_to_Play_in_Down_Left_Direction(position_x, position_y, pawn);
-            result |= Try_to_Play_in_Down_Right_Direction(position_x, position_y, pawn);
+            if (Is_Legal_Move(position_x, position_y, pawn)) { return true; }
         }
     }
 
-    return result;
+    return false;
 } // Can_Play
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
+bool Othellier::Is_Legal_Move(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) const noexcept
+{
+    // Only an empty slot can receive a pawn
+    if (!_othellier[position_x][position_y].Is_Empty()) { return false; }
+
+    // Neighbour slots - on the border, 0 - 1 wraps to the max unsigned int value and the direction loops stop right away
+    const unsigned int x_minus_1{position_x - 1};
+    const unsigned int x_plus_1 {position_x + 1};
+    const unsigned int y_minus_1{position_y - 1};
+    const unsigned int y_plus_1 {position_y + 1};
+
+    // The first direction which closes a line of opponent pawns is enough
+    return Try_to_Play_in_Up_Direction(position_x, y_minus_1, pawn)
+        || Try_to_Play_in_Down_Direction(position_x, y_plus_1, pawn)
+        || Try_to_Play_in_Left_Direction(x_minus_1, position_y, pawn)
+        || Try_to_Play_in_Right_Direction(x_plus_1, position_y, pawn)
+        || Try_to_Play_in_Up_Left_Direction(x_minus_1, y_minus_1, pawn)
+        || Try_to_Play_in_Up_Right_Direction(x_plus_1, y_minus_1, pawn)
+        || Try_to_Play_in_Down_Left_Direction(x_minus_1, y_plus_1, pawn)
+        || Try_to_Play_in_Down_Right_Direction(x_plus_1, y_plus_1, pawn);
+} // Is_Legal_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
 bool Othellier::Try_to_Play_in_Up_Direction(const unsigned int position_x, const unsigned int position_y, const Pawn & pawn) const noexcept
 {
     bool must_return_slot{false}, can_play{false};
 
-    for (auto y{position_y}; y > MIN_INDEX; --y)
+    for (auto y{position_y}; y < NUMBER_COLUMNS; --y)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(position_x, y)) { break; }
@@ -609,7 +647,7 @@ bool Othellier::Try_to_Play_in_Left_Direction(const unsigned int position_x, con
 {
     bool must_return_slot{false}, can_play{false};
 
-    for (auto x{position_x}; x > MIN_INDEX; --x)
+    for (auto x{position_x}; x < NUMBER_ROWS; --x)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(x, position_y)) { break; }
@@ -696,7 +734,7 @@ bool Othellier::Try_to_Play_in_Up_Left_Direction(const unsigned int position_x,
     auto x{position_x};
     auto y{position_y};
 
-    for (; x > MIN_INDEX || y > MIN_INDEX; --x, --y)
+    for (; x < NUMBER_ROWS && y < NUMBER_COLUMNS; --x, --y)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(x, y)) { break; }
@@ -741,7 +779,7 @@ bool Othellier::Try_to_Play_in_Up_Right_Direction(const unsigned int position_x,
     auto x{position_x};
     auto y{position_y};
 
-    for (; x < NUMBER_ROWS || y > MIN_INDEX; ++x, --y)
+    for (; x < NUMBER_ROWS && y < NUMBER_COLUMNS; ++x, --y)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(x, y)) { break; }
@@ -786,7 +824,7 @@ bool Othellier::Try_to_Play_in_Down_Left_Direction(const unsigned int position_x
     auto x{position_x};
     auto y{position_y};
 
-    for (; x > MIN_INDEX || y < NUMBER_COLUMNS; --x, ++y)
+    for (; x < NUMBER_ROWS && y < NUMBER_COLUMNS; --x, ++y)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(x, y)) { break; }
@@ -831,7 +869,7 @@ bool Othellier::Try_to_Play_in_Down_Right_Direction(const unsigned int position_
     auto x{position_x};
     auto y{position_y};
 
-    for (; x < NUMBER_ROWS || y < NUMBER_COLUMNS; ++x, ++y)
+    for (; x < NUMBER_ROWS && y < NUMBER_COLUMNS; ++x, ++y)
     {
         // I don't know where the overflow is so I suppress it
         if (Security_Check_Failed(x, y)) { break; }
@@ -875,6 +913,9 @@ void Othellier::Reset_Othellier(void) noexcept
     {
         for (unsigned int column{0}; column < NUMBER_COLUMNS; ++column)
         {
+            // The slot is emptied first, so a pawn from a previous game can't stay on it
+            _othellier[column][row].Set_Empty();
+
             // White Pawns
             if ( (row == 3 && column == 3) || (row == 4 && column == 4) ) {
                 _othellier[column][row].Occupy_Slot( Pawn{ E_Pawn_Color::WHITE } );
@@ -884,13 +925,12 @@ void Othellier::Reset_Othellier(void) noexcept
             else if ( (row == 3 && column == 4) || (row == 4 && column == 3) ) {
                 _othellier[column][row].Occupy_Slot( Pawn{ E_Pawn_Color::BLACK } );
             }
-
-            // Empty slot
-            else {
-                _othellier[column][row].Set_Empty();
-            }
         }
     }
+
+    _number_of_slots_occupied = 4;
+    _number_of_black_pawns = 2;
+    _number_of_white_pawns = 2;
 } // Reset_Othellier
 
 /********************************************************************************************************************************************************************/
@@ -898,30 +938,20 @@ void Othellier::Reset_Othellier(void) noexcept
 
 void Othellier::Draw_Othellier(void) const noexcept
 {
-    std::cout << std::endl << "  1 2 3 4 5 6 7 8   Axis X" << std::endl;
-
-    for (unsigned int row{0}; row < NUMBER_ROWS; ++row)
-    {
-        std::cout << row + 1;
+    // The whole othellier in one buffer, written at once
+    std::array<std::array<char, OTHELLIER_TEXT_COLUMNS + 1>, OTHELLIER_TEXT_ROWS> text;
+    std::array<char, OTHELLIER_TEXT_ROWS * (OTHELLIER_TEXT_COLUMNS + 1)> buffer;
+    std::size_t size{0};
 
-        for (unsigned int column{0}; column < NUMBER_COLUMNS; ++column)
-        {
-            std::cout << "|";
+    Format_Othellier(Get_Pawns(E_Pawn_Color::BLACK), Get_Pawns(E_Pawn_Color::WHITE), text);
 
-            if (_othellier[column][row].Is_Empty())
-            {
-                std::cout << " ";
-            }
-            else
-            {
-                _othellier[column][row].Get_Pawn_Color() == E_Pawn_Color::BLACK ? std::cout << "X" : std::cout << "O";
-            }
-        }
-
-         std::cout << "|" << std::endl;
+    for (const auto & line : text)
+    {
+        for (std::size_t character{0}; line[character] != '\0'; ++character) { buffer[size++] = line[character]; }
+        buffer[size++] = '\n';
     }
 
-    std::cout << "Axis Y" << std::endl;
+    std::cout.write(buffer.data(), static_cast<std::streamsize>(size)).flush();
 } // Draw_Othellier
 
 /********************************************************************************************************************************************************************/
@@ -930,58 +960,65 @@ void Othellier::Draw_Othellier(void) const noexcept
 std::pair<unsigned int, unsigned int> Othellier::Count_Pawns(void) const noexcept
 {
     // First = black player ; Second = white player
-    auto pawns = std::make_pair<unsigned int, unsigned int>(0, 0);
+    return std::make_pair(_number_of_black_pawns, _number_of_white_pawns);
+} // Count_Pawns
 
-    // Count pawns
-    for (unsigned int row{0}; row < NUMBER_ROWS; ++row)
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::pair<unsigned int, unsigned int> Othellier::Count_All_Pawns(void) const noexcept
+{
+    // First = black player ; Second = white player
+    auto pawns = Count_Pawns();
+    const unsigned int empty_slots{Get_Number_of_Free_Slots()};
+
+    // If no draw
+    if (pawns.first != pawns.second)
     {
-        for (unsigned int column{0}; column < NUMBER_COLUMNS; ++column)
-        {
-            if (!_othellier[column][row].Is_Empty())
-            {
-                _othellier[column][row].Get_Pawn_Color() == E_Pawn_Color::BLACK ? ++pawns.first : ++pawns.second;
-            }
-        }
+        // Empty pawns are given to the player who has the greatest number of pawns
+        if (pawns.first > pawns.second) { pawns.first  += empty_slots; }
+        else                            { pawns.second += empty_slots; }
     }
 
     return pawns;
-} // Count_Pawns
+} // Count_All_Pawns
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-std::pair<unsigned int, unsigned int> Othellier::Count_All_Pawns(void) const noexcept
+uint64_t Othellier::Get_Pawns(const E_Pawn_Color color) const noexcept
 {
-    // First = black player ; Second = white player
-    auto pawns = std::make_pair<unsigned int, unsigned int>(0, 0);
-    unsigned int empty_slots{0};
+    uint64_t pawns{0};
 
-    // Count pawns
     for (unsigned int row{0}; row < NUMBER_ROWS; ++row)
     {
         for (unsigned int column{0}; column < NUMBER_COLUMNS; ++column)
         {
-            if (_othellier[column][row].Is_Empty())
-            {
-                ++empty_slots;
-            }
-            else
+            if (!_othellier[column][row].Is_Empty() && _othellier[column][row].Get_Pawn_Color() == color)
             {
-                _othellier[column][row].Get_Pawn_Color() == E_Pawn_Color::BLACK ? ++pawns.first : ++pawns.second;
+                pawns |= Bitboard::Square_Bit(row * NUMBER_COLUMNS + column);
             }
         }
     }
 
-    // If no draw
-    if (pawns.first != pawns.second)
-    {
-        // Empty pawns are given to the player who has the greatest number of pawns
-        if (pawns.first > pawns.second) { pawns.first  += empty_slots; }
-        else                            { pawns.second += empty_slots; }
-    }
-
     return pawns;
-} // Count_All_Pawns
+} // Get_Pawns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Othellier::Get_Number_of_Occupied_Slots(void) const noexcept
+{
+    return _number_of_slots_occupied;
+} // Get_Number_of_Occupied_Slots
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Othellier::Get_Number_of_Free_Slots(void) const noexcept
+{
+    return NUMBER_ROWS * NUMBER_COLUMNS - _number_of_slots_occupied;
+} // Get_Number_of_Free_Slots
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
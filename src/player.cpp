@@ -7,15 +7,14 @@
 
 #include <string>
 #include <iostream>
-#include <algorithm>
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 /* Classe Implementation */
 /*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-Player::Player(const E_Pawn_Color color, std::shared_ptr<Othellier> othellier)
-    : _color(color), _othellier(othellier)
+Player::Player(const E_Pawn_Color color, std::shared_ptr<Board_Engine> othellier, std::shared_ptr<Input_Reader> input_reader)
+    : _color(color), _othellier(othellier), _input_reader(input_reader ? input_reader : std::make_shared<Input_Reader>())
 {
 } // Player
 
@@ -48,100 +47,100 @@ bool Player::Can_Play(void) const noexcept
 std::tuple<bool, E_Game_Command, unsigned int, unsigned int> Player::Try_Place_Pawn(void) noexcept
 {
     std::tuple<bool, E_Game_Command, unsigned int, unsigned int> result{false, E_Game_Command::NO_COMMAND, 0, 0};
+    std::string answer;
+    S_Move_Command command;
 
     // --------------------------------------------------------------------------------------------------------------------------------------------
 
-    // Quit the game
-    if (Ask_Quit_Game())
+    // One command per move : a wrong one is asked again at the next call
+    const E_Input_Status status{Ask_Move_Command(answer)};
+
+    // Nobody will answer any more : the player has left the game
+    if (status == E_Input_Status::CLOSED)
     {
         std::get<bool>(result) = true;
         std::get<E_Game_Command>(result) = E_Game_Command::QUIT_GAME;
         return result;
     }
 
-    // --------------------------------------------------------------------------------------------------------------------------------------------
+    if (status != E_Input_Status::LINE) { return result; }
 
-    // Play : try to place a pawn
-    unsigned int column = Ask_Position_X();
-    unsigned int line   = Ask_Position_Y();
+    // Analyze the answer
+    if (!Parse_Move_Command(answer, command))
+    {
+        std::cout << Get_Player_Name() << "\"" << answer << "\" is not a move : a column from a to h then a row from 1 to 8, pass or quit." << std::endl;
+        return result;
+    }
 
-    std::get<bool>(result) = _othellier->Place_Pawn(column, line, Pawn{ _color } );
+    // --------------------------------------------------------------------------------------------------------------------------------------------
+
+    switch (command.command)
+    {
+        // Quit the game
+        case E_Game_Command::QUIT_GAME:
+            std::get<bool>(result) = true;
+            std::get<E_Game_Command>(result) = E_Game_Command::QUIT_GAME;
+            break;
+
+        // A player who has a move must play it
+        case E_Game_Command::PASS_TURN:
+            if (Can_Play())
+            {
+                std::cout << Get_Player_Name() << "You can't pass, there is a move for you." << std::endl;
+            }
+            else
+            {
+                std::get<bool>(result) = true;
+                std::get<E_Game_Command>(result) = E_Game_Command::PASS_TURN;
+            }
+            break;
+
+        // Play : try to place a pawn
+        default:
+            std::get<bool>(result) = _othellier->Place_Pawn(command.column, command.line, Pawn{ _color });
+            std::get<2>(result) = command.column;
+            std::get<3>(result) = command.line;
+
+            if (!std::get<bool>(result)) { std::cout << Get_Player_Name() << "You can't play there." << std::endl; }
+            break;
+    }
 
     return result;
-} // Try_Place_Pawns
+} // Try_Place_Pawn
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-unsigned int Player::Ask_Position_X(void) const noexcept
+E_Input_Status Player::Ask_Move_Command(std::string & answer) const noexcept
 {
     // Ask to the player
-    std::cout << std::endl << (_color == E_Pawn_Color::BLACK ? "[Player 1] " : "[Player 2] ");
-    std::cout << "Please enter the X position to place your pawn [Range : 1 to 8]." << std::endl;
-
-    // Get the answer
-    std::string answer;
-    std::getline(std::cin, answer);
+    std::cout << std::endl << Get_Player_Name() << "Your move (d3 : column d, row 3), pass or quit :" << std::endl;
 
-    // Analyze the answer : check the string only contains digits and is not empty
-    if (std::all_of(answer.begin(), answer.end(), ::isdigit) && !answer.empty())
-    {
-        unsigned long ul_answer = std::stoul(answer, nullptr, 0);
-        return (unsigned int)ul_answer;
-    }
-
-    // Error
-    return 0;
-} // Ask_Position_X
+    // Get the answer : the input is polled, the search threads keep running while the player thinks
+    return _input_reader->Wait_Line(answer);
+} // Ask_Move_Command
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-unsigned int Player::Ask_Position_Y(void) const noexcept
+void Player::Pass_Turn(void) noexcept
 {
-    // Ask to the player
-    std::cout << std::endl << (_color == E_Pawn_Color::BLACK ? "[Player 1] " : "[Player 2] ");
-    std::cout << "Please enter the Y position to place your pawn [Range : 1 to 8]." << std::endl;
-
-    // Get the answer
-    std::string answer;
-    std::getline(std::cin, answer);
-
-    // Analyze the answer : check the string only contains digits and is not empty
-    if (std::all_of(answer.begin(), answer.end(), ::isdigit) && !answer.empty())
-    {
-        unsigned long ul_answer = std::stoul(answer, nullptr, 0);
-        return (unsigned int)ul_answer;
-    }
-
-    // Error
-    return 0;
-} // Ask_Position_Y
+} // Pass_Turn
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-bool Player::Ask_Quit_Game(void) const noexcept
+void Player::End_Game(void) noexcept
 {
-    // Ask to the player
-    std::cout << std::endl << (_color == E_Pawn_Color::BLACK ? "[Player 1] " : "[Player 2] ");
-    std::cout << "Would you like to quit the game ? (Y/N)" << std::endl;
-
-    // Get the answer
-    std::string answer;
-    std::getline(std::cin, answer);
-
-    // Formate the answer
-    std::transform(answer.begin(), answer.end(), answer.begin(), ::toupper);
+} // End_Game
 
-    // Analyze the answer
-    if (answer.find("Y") != std::string::npos)
-    {
-        return true;
-    }
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
 
-    return false;
-} // Ask_Position_Y
+const char * Player::Get_Player_Name(void) const noexcept
+{
+    return _color == E_Pawn_Color::BLACK ? "[Player 1] " : "[Player 2] ";
+} // Get_Player_Name
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
@@ -0,0 +1,332 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "position_batch.h"
+#include "bitboard.h"
+#include "bitboard_kernels.h"
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define INNER_COLUMNS   0x7E7E7E7E7E7E7E7EULL   // Opponent pawns which can be inside a line along a row or a diagonal (see bitboard_kernels.cpp)
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Positions from first to last, one after the other : used on the processors without vector kernels, and for the positions left after the last full register
+static void Scalar_Evaluate_Batch(const S_Batch_Arrays & arrays, const std::size_t first, const std::size_t last) noexcept
+{
+    for (std::size_t index{first}; index < last; ++index)
+    {
+        const uint64_t legal_moves{Bitboard::Get_Legal_Moves(arrays.players[index], arrays.opponents[index])};
+
+        arrays.legal_moves[index]    = legal_moves;
+        arrays.mobilities[index]     = static_cast<uint8_t>(Bitboard::Count_Bits(legal_moves));
+        arrays.player_pawns[index]   = static_cast<uint8_t>(Bitboard::Count_Bits(arrays.players[index]));
+        arrays.opponent_pawns[index] = static_cast<uint8_t>(Bitboard::Count_Bits(arrays.opponents[index]));
+    }
+} // Scalar_Evaluate_Batch
+
+#if defined(X86_64_KERNELS)
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Unlike bitboard_kernels.cpp, one lane holds one position : the eight directions are computed one after the other, with the same shift for every lane
+// Kogge-Stone fill of the lines of opponent pawns from the player pawns, both ways of the direction, then the slot after each line
+TARGET_AVX2 static inline __m256i AVX2_Batch_Moves_in_Direction(const __m256i players, const __m256i opponents, const int shift) noexcept
+{
+    const __m128i shift_1 {_mm_cvtsi32_si128(shift)};
+    const __m128i shift_2 {_mm_cvtsi32_si128(shift * 2)};
+
+    __m256i lines_left  {_mm256_and_si256(opponents, _mm256_sll_epi64(players, shift_1))};
+    __m256i lines_right {_mm256_and_si256(opponents, _mm256_srl_epi64(players, shift_1))};
+
+    lines_left  = _mm256_or_si256(lines_left,  _mm256_and_si256(opponents, _mm256_sll_epi64(lines_left,  shift_1)));
+    lines_right = _mm256_or_si256(lines_right, _mm256_and_si256(opponents, _mm256_srl_epi64(lines_right, shift_1)));
+
+    const __m256i propagator_left  {_mm256_and_si256(opponents, _mm256_sll_epi64(opponents, shift_1))};
+    const __m256i propagator_right {_mm256_srl_epi64(propagator_left, shift_1)};
+
+    lines_left  = _mm256_or_si256(lines_left,  _mm256_and_si256(propagator_left,  _mm256_sll_epi64(lines_left,  shift_2)));
+    lines_right = _mm256_or_si256(lines_right, _mm256_and_si256(propagator_right, _mm256_srl_epi64(lines_right, shift_2)));
+    lines_left  = _mm256_or_si256(lines_left,  _mm256_and_si256(propagator_left,  _mm256_sll_epi64(lines_left,  shift_2)));
+    lines_right = _mm256_or_si256(lines_right, _mm256_and_si256(propagator_right, _mm256_srl_epi64(lines_right, shift_2)));
+
+    return _mm256_or_si256(_mm256_sll_epi64(lines_left, shift_1), _mm256_srl_epi64(lines_right, shift_1));
+} // AVX2_Batch_Moves_in_Direction
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// 4 positions per register, the counts are made with the popcnt instruction of the same processors
+TARGET_AVX2 static void AVX2_Evaluate_Batch(const S_Batch_Arrays & arrays) noexcept
+{
+    const __m256i inner_columns {_mm256_set1_epi64x(static_cast<long long>(INNER_COLUMNS))};
+    std::size_t index{0};
+
+    for (; index + 4 <= arrays.size; index += 4)
+    {
+        const __m256i players   {_mm256_loadu_si256(reinterpret_cast<const __m256i *>(arrays.players + index))};
+        const __m256i opponents {_mm256_loadu_si256(reinterpret_cast<const __m256i *>(arrays.opponents + index))};
+        const __m256i inner_opponents {_mm256_and_si256(opponents, inner_columns)};
+
+        __m256i moves {AVX2_Batch_Moves_in_Direction(players, inner_opponents, 1)};
+
+        moves = _mm256_or_si256(moves, AVX2_Batch_Moves_in_Direction(players, opponents, 8));
+        moves = _mm256_or_si256(moves, AVX2_Batch_Moves_in_Direction(players, inner_opponents, 7));
+        moves = _mm256_or_si256(moves, AVX2_Batch_Moves_in_Direction(players, inner_opponents, 9));
+        moves = _mm256_andnot_si256(_mm256_or_si256(players, opponents), moves);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(arrays.legal_moves + index), moves);
+
+        for (std::size_t lane{index}; lane < index + 4; ++lane)
+        {
+            arrays.mobilities[lane]     = static_cast<uint8_t>(Bitboard::Count_Bits(arrays.legal_moves[lane]));
+            arrays.player_pawns[lane]   = static_cast<uint8_t>(Bitboard::Count_Bits(arrays.players[lane]));
+            arrays.opponent_pawns[lane] = static_cast<uint8_t>(Bitboard::Count_Bits(arrays.opponents[lane]));
+        }
+    }
+
+    Scalar_Evaluate_Batch(arrays, index, arrays.size);
+} // AVX2_Evaluate_Batch
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// GCC 12 headers build the 512 bits results from an "undefined" register it then reports as uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// Same fill as AVX2_Batch_Moves_in_Direction, 8 positions per register
+TARGET_AVX512 static inline __m512i AVX512_Batch_Moves_in_Direction(const __m512i players, const __m512i opponents, const int shift) noexcept
+{
+    const __m128i shift_1 {_mm_cvtsi32_si128(shift)};
+    const __m128i shift_2 {_mm_cvtsi32_si128(shift * 2)};
+
+    __m512i lines_left  {_mm512_and_si512(opponents, _mm512_sll_epi64(players, shift_1))};
+    __m512i lines_right {_mm512_and_si512(opponents, _mm512_srl_epi64(players, shift_1))};
+
+    lines_left  = _mm512_or_si512(lines_left,  _mm512_and_si512(opponents, _mm512_sll_epi64(lines_left,  shift_1)));
+    lines_right = _mm512_or_si512(lines_right, _mm512_and_si512(opponents, _mm512_srl_epi64(lines_right, shift_1)));
+
+    const __m512i propagator_left  {_mm512_and_si512(opponents, _mm512_sll_epi64(opponents, shift_1))};
+    const __m512i propagator_right {_mm512_srl_epi64(propagator_left, shift_1)};
+
+    lines_left  = _mm512_or_si512(lines_left,  _mm512_and_si512(propagator_left,  _mm512_sll_epi64(lines_left,  shift_2)));
+    lines_right = _mm512_or_si512(lines_right, _mm512_and_si512(propagator_right, _mm512_srl_epi64(lines_right, shift_2)));
+    lines_left  = _mm512_or_si512(lines_left,  _mm512_and_si512(propagator_left,  _mm512_sll_epi64(lines_left,  shift_2)));
+    lines_right = _mm512_or_si512(lines_right, _mm512_and_si512(propagator_right, _mm512_srl_epi64(lines_right, shift_2)));
+
+    return _mm512_or_si512(_mm512_sll_epi64(lines_left, shift_1), _mm512_srl_epi64(lines_right, shift_1));
+} // AVX512_Batch_Moves_in_Direction
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+TARGET_AVX512 static void AVX512_Evaluate_Batch(const S_Batch_Arrays & arrays) noexcept
+{
+    const __m512i inner_columns {_mm512_set1_epi64(static_cast<long long>(INNER_COLUMNS))};
+    std::size_t index{0};
+
+    for (; index + 8 <= arrays.size; index += 8)
+    {
+        const __m512i players   {_mm512_loadu_si512(arrays.players + index)};
+        const __m512i opponents {_mm512_loadu_si512(arrays.opponents + index)};
+        const __m512i inner_opponents {_mm512_and_si512(opponents, inner_columns)};
+
+        __m512i moves {AVX512_Batch_Moves_in_Direction(players, inner_opponents, 1)};
+
+        moves = _mm512_or_si512(moves, AVX512_Batch_Moves_in_Direction(players, opponents, 8));
+        moves = _mm512_or_si512(moves, AVX512_Batch_Moves_in_Direction(players, inner_opponents, 7));
+        moves = _mm512_or_si512(moves, AVX512_Batch_Moves_in_Direction(players, inner_opponents, 9));
+        moves = _mm512_andnot_si512(_mm512_or_si512(players, opponents), moves);
+
+        _mm512_storeu_si512(arrays.legal_moves + index, moves);
+
+        for (std::size_t lane{index}; lane < index + 8; ++lane)
+        {
+            arrays.mobilities[lane]     = static_cast<uint8_t>(Bitboard::Count_Bits(arrays.legal_moves[lane]));
+            arrays.player_pawns[lane]   = static_cast<uint8_t>(Bitboard::Count_Bits(arrays.players[lane]));
+            arrays.opponent_pawns[lane] = static_cast<uint8_t>(Bitboard::Count_Bits(arrays.opponents[lane]));
+        }
+    }
+
+    Scalar_Evaluate_Batch(arrays, index, arrays.size);
+} // AVX512_Evaluate_Batch
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // X86_64_KERNELS
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Batch Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+void Evaluate_Batch(const S_Batch_Arrays & arrays) noexcept
+{
+    // The kernels selected at startup tell which instructions the processor supports
+    switch (Bitboard::kernels.type)
+    {
+#if defined(X86_64_KERNELS)
+        case E_Kernel_Type::AVX512:
+            AVX512_Evaluate_Batch(arrays);
+            break;
+
+        case E_Kernel_Type::AVX2:
+            AVX2_Evaluate_Batch(arrays);
+            break;
+#endif
+
+        default:
+            Scalar_Evaluate_Batch(arrays, 0, arrays.size);
+            break;
+    }
+} // Evaluate_Batch
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Position_Batch::Position_Batch(const std::size_t capacity)
+{
+    Reserve(capacity);
+} // Position_Batch
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Position_Batch::~Position_Batch()
+{
+} // ~Position_Batch
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Position_Batch::Reserve(const std::size_t capacity)
+{
+    _players.reserve(capacity);
+    _opponents.reserve(capacity);
+    _legal_moves.reserve(capacity);
+    _mobilities.reserve(capacity);
+    _player_pawns.reserve(capacity);
+    _opponent_pawns.reserve(capacity);
+} // Reserve
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Position_Batch::Clear(void) noexcept
+{
+    _players.clear();
+    _opponents.clear();
+    _legal_moves.clear();
+    _mobilities.clear();
+    _player_pawns.clear();
+    _opponent_pawns.clear();
+} // Clear
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Position_Batch::Add(const uint64_t player, const uint64_t opponent)
+{
+    _players.push_back(player);
+    _opponents.push_back(opponent);
+
+    // The results get their slot now : Evaluate doesn't allocate
+    _legal_moves.push_back(0);
+    _mobilities.push_back(0);
+    _player_pawns.push_back(0);
+    _opponent_pawns.push_back(0);
+
+    return _players.size() - 1;
+} // Add
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Position_Batch::Add(const Board_Engine & othellier, const E_Pawn_Color color)
+{
+    return Add(othellier.Get_Pawns(color), othellier.Get_Pawns(Get_Opponent_Color(color)));
+} // Add
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Position_Batch::Evaluate(void) noexcept
+{
+    Evaluate_Batch(S_Batch_Arrays{_players.size(), _players.data(), _opponents.data(), _legal_moves.data(), _mobilities.data(), _player_pawns.data(), _opponent_pawns.data()});
+} // Evaluate
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Position_Batch::Get_Size(void) const noexcept
+{
+    return _players.size();
+} // Get_Size
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const uint64_t * Position_Batch::Get_Players(void) const noexcept
+{
+    return _players.data();
+} // Get_Players
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const uint64_t * Position_Batch::Get_Opponents(void) const noexcept
+{
+    return _opponents.data();
+} // Get_Opponents
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const uint64_t * Position_Batch::Get_Legal_Moves(void) const noexcept
+{
+    return _legal_moves.data();
+} // Get_Legal_Moves
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const uint8_t * Position_Batch::Get_Mobilities(void) const noexcept
+{
+    return _mobilities.data();
+} // Get_Mobilities
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const uint8_t * Position_Batch::Get_Player_Pawns(void) const noexcept
+{
+    return _player_pawns.data();
+} // Get_Player_Pawns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+const uint8_t * Position_Batch::Get_Opponent_Pawns(void) const noexcept
+{
+    return _opponent_pawns.data();
+} // Get_Opponent_Pawns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
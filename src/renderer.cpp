@@ -0,0 +1,211 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "renderer.h"
+#include "bitboard.h"
+#include "othellier.h"
+
+#include <algorithm>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define CURSOR_MOVE_SIZE    8   // ESC [ row ; column H, with rows and columns under 100
+#define MAX_SKIPPED_CELLS   4   // Unchanged cells between two changes are sent again when it is shorter than a cursor move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Terminal_Renderer::Terminal_Renderer(const unsigned int rows, const unsigned int columns, std::FILE * output)
+    : _rows(rows), _columns(columns), _frame(rows * columns, ' '), _screen(rows * columns, ' '), _output_file(output), _full_repaint(true)
+{
+    // Worst case : every cell after a cursor move, plus the clears and the final cursor move
+    _output.reserve(rows * columns * (CURSOR_MOVE_SIZE + 1) + 4 * CURSOR_MOVE_SIZE);
+} // Terminal_Renderer
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Terminal_Renderer::~Terminal_Renderer()
+{
+} // ~Terminal_Renderer
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Terminal_Renderer::Clear_Frame(void) noexcept
+{
+    std::fill(_frame.begin(), _frame.end(), ' ');
+} // Clear_Frame
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Terminal_Renderer::Draw_Text(const unsigned int row, const unsigned int column, const char * text) noexcept
+{
+    if (row >= _rows) { return; }
+
+    for (unsigned int cell{column}; cell < _columns && *text != '\0' && *text != '\n'; ++cell, ++text)
+    {
+        _frame[row * _columns + cell] = *text;
+    }
+} // Draw_Text
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Terminal_Renderer::Draw_Othellier(const Board_Engine & othellier, const unsigned int row, const unsigned int column) noexcept
+{
+    std::array<std::array<char, OTHELLIER_TEXT_COLUMNS + 1>, OTHELLIER_TEXT_ROWS> text;
+
+    Format_Othellier(othellier.Get_Pawns(E_Pawn_Color::BLACK), othellier.Get_Pawns(E_Pawn_Color::WHITE), text);
+
+    for (unsigned int line{0}; line < OTHELLIER_TEXT_ROWS; ++line) { Draw_Text(row + line, column, text[line].data()); }
+} // Draw_Othellier
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Terminal_Renderer::Present(void) noexcept
+{
+    _output.clear();
+
+    // The screen is unknown : cleared first, so only the cells which are not spaces are sent
+    if (_full_repaint)
+    {
+        _output += "\x1b[H\x1b[2J";
+        std::fill(_screen.begin(), _screen.end(), ' ');
+        _full_repaint = false;
+    }
+
+    for (unsigned int row{0}; row < _rows; ++row)
+    {
+        const unsigned int first_cell{row * _columns};
+        unsigned int cursor_column{_columns + MAX_SKIPPED_CELLS + 1};     // Not on this row yet
+
+        for (unsigned int column{0}; column < _columns; ++column)
+        {
+            if (_frame[first_cell + column] == _screen[first_cell + column]) { continue; }
+
+            // Close enough on the same row : the cells in between are sent again (they did not change) instead of moving the cursor
+            if (column >= cursor_column && column - cursor_column <= MAX_SKIPPED_CELLS)
+            {
+                _output.append(&_frame[first_cell + cursor_column], column - cursor_column);
+            }
+            else
+            {
+                Append_Cursor_Move(row, column);
+            }
+
+            _output += _frame[first_cell + column];
+            cursor_column = column + 1;
+        }
+    }
+
+    // The text printed after the frame (questions, search results) starts under it, over the text of the previous frame
+    Append_Cursor_Move(_rows, 0);
+    _output += "\x1b[J";
+
+    std::copy(_frame.begin(), _frame.end(), _screen.begin());
+
+    // One write, one flush per frame
+    std::fwrite(_output.data(), 1, _output.size(), _output_file);
+    std::fflush(_output_file);
+
+    return _output.size();
+} // Present
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Terminal_Renderer::Invalidate(void) noexcept
+{
+    _full_repaint = true;
+} // Invalidate
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Terminal_Renderer::Get_Rows(void) const noexcept
+{
+    return _rows;
+} // Get_Rows
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Terminal_Renderer::Get_Columns(void) const noexcept
+{
+    return _columns;
+} // Get_Columns
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Terminal_Renderer::Append_Cursor_Move(const unsigned int row, const unsigned int column) noexcept
+{
+    // ANSI rows and columns start at 1
+    char sequence[32];
+    unsigned int size{0};
+    unsigned int numbers[2]{row + 1, column + 1};
+
+    sequence[size++] = '\x1b';
+    sequence[size++] = '[';
+
+    for (unsigned int index{0}; index < 2; ++index)
+    {
+        char digits[10];
+        unsigned int number_of_digits{0};
+
+        do { digits[number_of_digits++] = static_cast<char>('0' + numbers[index] % 10); numbers[index] /= 10; } while (numbers[index] > 0);
+        while (number_of_digits > 0) { sequence[size++] = digits[--number_of_digits]; }
+
+        sequence[size++] = index == 0 ? ';' : 'H';
+    }
+
+    _output.append(sequence, size);
+} // Append_Cursor_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Display Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+void Format_Othellier(const uint64_t black_pawns, const uint64_t white_pawns,
+                      std::array<std::array<char, OTHELLIER_TEXT_COLUMNS + 1>, OTHELLIER_TEXT_ROWS> & text) noexcept
+{
+    static const char axis_x[]{"  a b c d e f g h   Axis X"};
+    static const char axis_y[]{"Axis Y"};
+
+    for (auto & line : text) { line.fill('\0'); }
+
+    std::copy(axis_x, axis_x + sizeof(axis_x) - 1, text[1].begin());
+
+    for (unsigned int row{0}; row < NUMBER_ROWS; ++row)
+    {
+        auto & line = text[row + 2];
+
+        line[0] = static_cast<char>('1' + row);
+
+        for (unsigned int column{0}; column < NUMBER_COLUMNS; ++column)
+        {
+            const uint64_t slot{Bitboard::Square_Bit(row * NUMBER_COLUMNS + column)};
+
+            line[2 * column + 1] = '|';
+            line[2 * column + 2] = (black_pawns & slot) ? 'X' : ((white_pawns & slot) ? 'O' : ' ');
+        }
+
+        line[2 * NUMBER_COLUMNS + 1] = '|';
+    }
+
+    std::copy(axis_y, axis_y + sizeof(axis_y) - 1, text[OTHELLIER_TEXT_ROWS - 1].begin());
+} // Format_Othellier
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,717 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "search.h"
+#include "bitboard.h"
+#include "bitboard_kernels.h"
+#include "stability.h"
+#include "zobrist.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define MOBILITY_VALUE  10  // Value of one move of difference between the two sides
+#define FRONTIER_VALUE  5   // Value of one frontier pawn of difference, against the side which has them
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Variables */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Value of a pawn on each slot : corners are worth a lot, the slots next to them give the corners away
+static const std::array<int, NUMBER_SQUARES> square_values
+{{
+    100, -20,  10,   5,   5,  10, -20, 100,
+    -20, -50,  -2,  -2,  -2,  -2, -50, -20,
+     10,  -2,  -1,  -1,  -1,  -1,  -2,  10,
+      5,  -2,  -1,  -1,  -1,  -1,  -2,   5,
+      5,  -2,  -1,  -1,  -1,  -1,  -2,   5,
+     10,  -2,  -1,  -1,  -1,  -1,  -2,  10,
+    -20, -50,  -2,  -2,  -2,  -2, -50, -20,
+    100, -20,  10,   5,   5,  10, -20, 100
+}};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Search_Engine::Search_Engine(const unsigned int number_of_threads, const std::size_t hash_size_mb)
+    : _idle_threads(0), _quit(false), _transposition_table(hash_size_mb), _evaluation_weights(nullptr), _move_ordering_settings{true, true, true, true}, _stop(false), _stop_requested(false), _deadline(0), _requested_deadline(0)
+{
+    Set_Number_of_Threads(number_of_threads);
+} // Search_Engine
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Search_Engine::~Search_Engine()
+{
+    Stop_Helper_Threads();
+} // ~Search_Engine
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Set_Number_of_Threads(unsigned int number_of_threads)
+{
+    // 0 means one thread per core
+    if (number_of_threads == 0) { number_of_threads = std::max(1U, std::thread::hardware_concurrency()); }
+
+    Stop_Helper_Threads();
+
+    _threads.clear();
+    _quit = false;
+    _idle_threads = 0;
+
+    for (unsigned int index{0}; index < number_of_threads; ++index)
+    {
+        _threads.push_back(std::make_unique<S_Search_Thread>());
+        _threads.back()->split_point = nullptr;
+        _threads.back()->assigned_split_point = nullptr;
+        _threads.back()->waiting_split_point = nullptr;
+        _threads.back()->idle = false;
+        _threads.back()->move_ordering.Set_Settings(_move_ordering_settings);
+    }
+
+    // The main thread is the caller of Search, only the helpers get their own thread
+    for (unsigned int index{1}; index < number_of_threads; ++index)
+    {
+        S_Search_Thread & helper = *_threads[index];
+        helper.thread = std::thread([this, &helper]() { Helper_Loop(helper); });
+    }
+} // Set_Number_of_Threads
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Search_Engine::Get_Number_of_Threads(void) const noexcept
+{
+    return static_cast<unsigned int>(_threads.size());
+} // Get_Number_of_Threads
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Set_Hash_Size(const std::size_t hash_size_mb)
+{
+    _transposition_table.Resize(hash_size_mb);
+} // Set_Hash_Size
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Clear_Hash(void) noexcept
+{
+    _transposition_table.Clear();
+
+    for (auto & thread : _threads) { thread->move_ordering.Clear(); }
+} // Clear_Hash
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Set_Move_Ordering(const S_Move_Ordering_Settings & settings) noexcept
+{
+    _move_ordering_settings = settings;
+
+    for (auto & thread : _threads) { thread->move_ordering.Set_Settings(settings); }
+} // Set_Move_Ordering
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Stop(void) noexcept
+{
+    _stop_requested = true;
+} // Stop
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Clear_Stop(void) noexcept
+{
+    _stop_requested = false;
+    _requested_deadline = 0;
+} // Clear_Stop
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Set_Time_Budget(const unsigned int time_budget_ms) noexcept
+{
+    const std::chrono::steady_clock::rep deadline{(std::chrono::steady_clock::now() + std::chrono::milliseconds(time_budget_ms)).time_since_epoch().count()};
+
+    // Requested first : a search starting now either reads the request, or sets its deadline before this one
+    _requested_deadline = deadline;
+    _deadline = deadline;
+} // Set_Time_Budget
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Search_Engine::Get_Hash_Move(const Board_Engine & othellier, const E_Pawn_Color color) const noexcept
+{
+    const uint64_t moves{othellier.Generate_Legal_Moves(color)};
+    if (!moves) { return NO_MOVE; }
+
+    // Same key as the search : the side to play is part of the position
+    const uint64_t hash_key{Compute_Hash_Key(othellier.Get_Pawns(E_Pawn_Color::BLACK), othellier.Get_Pawns(E_Pawn_Color::WHITE))
+                          ^ (color == E_Pawn_Color::WHITE ? zobrist_keys.white_to_play : 0)};
+    S_Hash_Entry entry;
+
+    if (_transposition_table.Probe(hash_key, entry) && entry.best_move < NO_MOVE && (moves & Bitboard::Square_Bit(entry.best_move))) { return entry.best_move; }
+
+    return Bitboard::First_Square(moves);
+} // Get_Hash_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Set_Evaluation_Weights(std::shared_ptr<const Pattern_Weights> evaluation_weights) noexcept
+{
+    _evaluation_weights = evaluation_weights;
+} // Set_Evaluation_Weights
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+S_Search_Result Search_Engine::Search(const Board_Engine & othellier, const E_Pawn_Color color, const unsigned int time_budget_ms, const unsigned int max_depth) noexcept
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    S_Search_Result result{NO_MOVE, 0, 0, 0, 0, 0, 0, 0, 0};
+    S_Search_Thread & main_thread = *_threads[0];
+
+    main_thread.othellier.Set_Othellier(othellier.Get_Pawns(E_Pawn_Color::BLACK), othellier.Get_Pawns(E_Pawn_Color::WHITE));
+    if (_evaluation_weights) { main_thread.evaluator.Set_Position(othellier.Get_Pawns(E_Pawn_Color::BLACK), othellier.Get_Pawns(E_Pawn_Color::WHITE)); }
+    for (auto & thread : _threads)
+    {
+        thread->nodes = 0;
+        thread->hash_probes = 0;
+        thread->hash_hits = 0;
+        thread->move_ordering.New_Search();
+    }
+
+    // The entries of the previous searches are kept, but replaced first
+    _transposition_table.New_Search();
+    _stop = false;
+    _deadline = (start + std::chrono::milliseconds(time_budget_ms)).time_since_epoch().count();
+
+    // A time budget given before the search started (the move of the opponent arrived as the pondering started) is not lost
+    const std::chrono::steady_clock::rep requested_deadline{_requested_deadline};
+    if (requested_deadline != 0) { _deadline = requested_deadline; }
+
+    const uint64_t legal_moves{main_thread.othellier.Generate_Legal_Moves(color)};
+
+    if (legal_moves)
+    {
+        // A move is always available, even if the first depth can't be completed in time
+        result.best_move = Bitboard::First_Square(legal_moves);
+
+        // Nothing to search deeper than the end of the game
+        const unsigned int free_slots{main_thread.othellier.Get_Number_of_Free_Slots()};
+        const unsigned int last_depth{max_depth < free_slots ? max_depth : free_slots};
+
+        for (unsigned int depth{1}; depth <= last_depth; ++depth)
+        {
+            unsigned int best_move{result.best_move};
+            const int score{Search_Root(depth, color, best_move)};
+
+            // An interrupted depth is not reliable : keep the result of the previous one
+            if (_stop) { break; }
+
+            result.best_move = best_move;
+            result.score = score;
+            result.depth = depth;
+
+            if (Is_Time_Over()) { break; }
+        }
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    for (const auto & thread : _threads)
+    {
+        result.nodes += thread->nodes;
+        result.hash_probes += thread->hash_probes;
+        result.hash_hits += thread->hash_hits;
+    }
+
+    result.hash_usage_permille = _transposition_table.Get_Usage_Permille();
+    result.elapsed_ms = static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+    result.nodes_per_second = static_cast<unsigned long long>(result.nodes / (std::chrono::duration<double>(elapsed).count() + 1e-9));
+    _requested_deadline = 0;
+
+    return result;
+} // Search
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Search_Engine::Search_Root(const unsigned int depth, const E_Pawn_Color color, unsigned int & best_move) noexcept
+{
+    S_Search_Thread & main_thread = *_threads[0];
+    int alpha{-SCORE_INFINITE};
+    const unsigned int previous_best_move{best_move};
+
+    // The best move of the previous depth is searched first, it gives the best bound for the other moves
+    const uint64_t moves{main_thread.othellier.Generate_Legal_Moves(color) & ~Bitboard::Square_Bit(previous_best_move)};
+    const unsigned int ply{Bitboard::Count_Bits(main_thread.othellier.Get_Pawns(E_Pawn_Color::BLACK) | main_thread.othellier.Get_Pawns(E_Pawn_Color::WHITE))};
+    std::array<uint8_t, NUMBER_SQUARES> ordered_moves;
+    const unsigned int number_of_moves{main_thread.move_ordering.Order_Moves(moves, NO_MOVE, ply, color, ordered_moves)};
+    unsigned int move{previous_best_move};
+
+    for (unsigned int index{0}; true; ++index)
+    {
+        Make_Move(main_thread, move, color);
+        const int score{-Negamax(main_thread, depth - 1, -SCORE_INFINITE, -alpha, Get_Opponent_Color(color), false)};
+        Unmake_Move(main_thread);
+
+        if (_stop) { break; }
+
+        if (score > alpha)
+        {
+            alpha = score;
+            best_move = move;
+        }
+
+        if (index == number_of_moves) { break; }
+
+        move = ordered_moves[index];
+    }
+
+    return alpha;
+} // Search_Root
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Search_Engine::Negamax(S_Search_Thread & thread, const unsigned int depth, int alpha, int beta, const E_Pawn_Color color, const bool opponent_passed) noexcept
+{
+    ++thread.nodes;
+
+    // The clock is only read from time to time, by every thread : a helper deep in its split point stops at the deadline as well as the main thread
+    if ((thread.nodes & 0x3FF) == 0 && Is_Time_Over()) { _stop = true; }
+    if (Is_Aborted(thread)) { return 0; }
+
+    const uint64_t player  {thread.othellier.Get_Pawns(color)};
+    const uint64_t opponent{thread.othellier.Get_Opponent_Pawns(color)};
+
+    if (depth == 0) { return Evaluate(thread, color, player, opponent); }
+
+    const uint64_t moves{Bitboard::Fast_Legal_Moves(player, opponent)};
+
+    // No move : pass, or end of the game if the opponent passed too
+    if (!moves)
+    {
+        if (opponent_passed) { return Final_Score(player, opponent); }
+        return -Negamax(thread, depth, -beta, -alpha, Get_Opponent_Color(color), true);
+    }
+
+    // The side to play is part of the position
+    const uint64_t hash_key{thread.othellier.Get_Hash_Key() ^ (color == E_Pawn_Color::WHITE ? zobrist_keys.white_to_play : 0)};
+    unsigned int hash_move{NO_MOVE};
+    S_Hash_Entry entry;
+
+    ++thread.hash_probes;
+
+    if (_transposition_table.Probe(hash_key, entry))
+    {
+        ++thread.hash_hits;
+
+        // A score from a search at least as deep is used as it is if its bound allows it
+        if (entry.depth >= depth)
+        {
+            if (entry.bound == E_Bound_Type::EXACT)                             { return entry.score; }
+            if (entry.bound == E_Bound_Type::LOWER && entry.score >= beta)      { return entry.score; }
+            if (entry.bound == E_Bound_Type::UPPER && entry.score <= alpha)     { return entry.score; }
+        }
+
+        hash_move = entry.best_move;
+    }
+
+    const int original_alpha{alpha};
+    int best_score{-SCORE_INFINITE};
+    unsigned int best_move{NO_MOVE};
+
+    // The best move found by a previous search of this position first, then the killers, the history and the slots (move_ordering.h)
+    const unsigned int ply{Bitboard::Count_Bits(player | opponent)};
+    std::array<uint8_t, NUMBER_SQUARES> ordered_moves;
+    const unsigned int number_of_moves{thread.move_ordering.Order_Moves(moves, hash_move, ply, color, ordered_moves)};
+
+    for (unsigned int index{0}; index < number_of_moves; ++index)
+    {
+        const unsigned int move{ordered_moves[index]};
+
+        Make_Move(thread, move, color);
+        const int score{-Negamax(thread, depth - 1, -beta, -alpha, Get_Opponent_Color(color), false)};
+        Unmake_Move(thread);
+
+        if (Is_Aborted(thread)) { return 0; }
+
+        if (score > best_score)
+        {
+            best_score = score;
+            best_move = move;
+
+            if (score > alpha)
+            {
+                alpha = score;
+                if (alpha >= beta) { break; } // Cut-off : the opponent won't allow this line
+            }
+        }
+
+        // Young brothers : once the first move is searched, the other ones can be shared with the idle threads
+        if (index + 1 < number_of_moves && depth >= SPLIT_MIN_DEPTH && _idle_threads > 0)
+        {
+            best_score = Split(thread, ordered_moves, index + 1, number_of_moves, depth, alpha, beta, best_score, best_move, color);
+            if (Is_Aborted(thread)) { return 0; }
+            break;
+        }
+    }
+
+    // Aborted searches never get here, the score stored is always reliable
+    const E_Bound_Type bound{best_score <= original_alpha ? E_Bound_Type::UPPER : (best_score >= beta ? E_Bound_Type::LOWER : E_Bound_Type::EXACT)};
+    _transposition_table.Store(hash_key, depth, bound, best_score, best_move);
+
+    // A move which raised alpha will be tried early in the other nodes with as many pawns
+    if (bound != E_Bound_Type::UPPER) { thread.move_ordering.Update(best_move, ply, depth, color); }
+
+    return best_score;
+} // Negamax
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Search_Engine::Split(S_Search_Thread & thread, const std::array<uint8_t, NUMBER_SQUARES> & moves, const unsigned int first_move, const unsigned int number_of_moves,
+                         const unsigned int depth, const int alpha, const int beta, const int best_score, unsigned int & best_move, const E_Pawn_Color color) noexcept
+{
+    S_Split_Point split_point;
+
+    split_point.parent          = thread.split_point;
+    split_point.black_pawns     = thread.othellier.Get_Pawns(E_Pawn_Color::BLACK);
+    split_point.white_pawns     = thread.othellier.Get_Pawns(E_Pawn_Color::WHITE);
+    split_point.color           = color;
+    split_point.depth           = depth;
+    split_point.beta            = beta;
+    split_point.moves           = moves;
+    split_point.number_of_moves = number_of_moves;
+    split_point.next_move       = first_move;
+    split_point.alpha           = alpha;
+    split_point.best_score      = best_score;
+    split_point.best_move       = best_move;
+    split_point.workers         = 1;
+    split_point.cutoff          = false;
+
+    // Give the split point to every idle helper - they only see it once the threads mutex is released
+    // A thread waiting for its own split point only takes one below it : it must be back as soon as its helpers are done
+    {
+        std::lock_guard<std::mutex> lock(_threads_mutex);
+
+        for (auto & helper : _threads)
+        {
+            if (helper->idle && helper->assigned_split_point == nullptr && Is_Below(split_point, helper->waiting_split_point))
+            {
+                helper->assigned_split_point = &split_point;
+                helper->idle = false;
+                --_idle_threads;
+                ++split_point.workers;
+            }
+        }
+    }
+
+    _threads_condition.notify_all();
+
+    // The thread which split works on its own split point too, then helps the threads still searching it
+    Search_Split_Point(thread, split_point);
+    Wait_Split_Point(thread, split_point);
+
+    best_move = split_point.best_move;
+    return split_point.best_score;
+} // Split
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Search_Split_Point(S_Search_Thread & thread, S_Split_Point & split_point) noexcept
+{
+    S_Split_Point * const previous_split_point{thread.split_point};
+    thread.split_point = &split_point;
+
+    while (true)
+    {
+        unsigned int move{NO_MOVE};
+        int alpha{0};
+
+        {
+            std::lock_guard<std::mutex> lock(split_point.mutex);
+
+            if (split_point.next_move < split_point.number_of_moves && !Is_Aborted(thread))
+            {
+                move = split_point.moves[split_point.next_move++];
+                alpha = split_point.alpha;
+            }
+        }
+
+        if (move == NO_MOVE) { break; }
+
+        Make_Move(thread, move, split_point.color);
+        const int score{-Negamax(thread, split_point.depth - 1, -split_point.beta, -alpha, Get_Opponent_Color(split_point.color), false)};
+        Unmake_Move(thread);
+
+        // The score of an aborted search is meaningless
+        if (Is_Aborted(thread)) { break; }
+
+        std::lock_guard<std::mutex> lock(split_point.mutex);
+
+        if (score > split_point.best_score)
+        {
+            split_point.best_score = score;
+            split_point.best_move = move;
+
+            if (score > split_point.alpha)
+            {
+                split_point.alpha = score;
+                if (score >= split_point.beta) { split_point.cutoff = true; }
+            }
+        }
+    }
+
+    thread.split_point = previous_split_point;
+
+    bool last_worker{false};
+
+    {
+        std::lock_guard<std::mutex> lock(split_point.mutex);
+        last_worker = --split_point.workers == 0;
+    }
+
+    // The thread which split sleeps until the last worker leaves : the split point must not be used anymore
+    if (last_worker)
+    {
+        std::lock_guard<std::mutex> lock(_threads_mutex);
+        _threads_condition.notify_all();
+    }
+} // Search_Split_Point
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Join_Split_Point(S_Search_Thread & thread, S_Split_Point & split_point) noexcept
+{
+    thread.othellier.Set_Othellier(split_point.black_pawns, split_point.white_pawns);
+    if (_evaluation_weights) { thread.evaluator.Set_Position(split_point.black_pawns, split_point.white_pawns); }
+
+    Search_Split_Point(thread, split_point);
+} // Join_Split_Point
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Wait_Split_Point(S_Search_Thread & thread, S_Split_Point & split_point) noexcept
+{
+    std::unique_lock<std::mutex> lock(_threads_mutex);
+
+    // Helpful master : while its helpers are searching, the thread is idle for the split points they create below its own
+    thread.waiting_split_point = &split_point;
+    thread.idle = true;
+    ++_idle_threads;
+
+    while (true)
+    {
+        if (thread.assigned_split_point)
+        {
+            S_Split_Point * const helped_split_point{thread.assigned_split_point};
+            thread.assigned_split_point = nullptr;
+            lock.unlock();
+
+            // Helping moves the othellier and the evaluator to another node, the ones of the waiting node are put back afterwards
+            const Bitboard_Othellier othellier{thread.othellier};
+            const Pattern_Evaluator evaluator{thread.evaluator};
+
+            Join_Split_Point(thread, *helped_split_point);
+
+            thread.othellier = othellier;
+            thread.evaluator = evaluator;
+
+            lock.lock();
+            thread.idle = true;
+            ++_idle_threads;
+        }
+
+        {
+            std::lock_guard<std::mutex> split_lock(split_point.mutex);
+            if (split_point.workers == 0) { break; }
+        }
+
+        // Woken by Split giving it a split point, or by the last worker leaving its own
+        _threads_condition.wait(lock);
+    }
+
+    thread.waiting_split_point = nullptr;
+    thread.idle = false;
+    --_idle_threads;
+} // Wait_Split_Point
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Search_Engine::Is_Aborted(const S_Search_Thread & thread) const noexcept
+{
+    if (_stop) { return true; }
+
+    // A cut-off in any split point above the thread makes its work useless
+    for (const S_Split_Point * split_point{thread.split_point}; split_point; split_point = split_point->parent)
+    {
+        if (split_point->cutoff) { return true; }
+    }
+
+    return false;
+} // Is_Aborted
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Search_Engine::Is_Below(const S_Split_Point & split_point, const S_Split_Point * const ancestor) const noexcept
+{
+    if (ancestor == nullptr) { return true; }
+
+    for (const S_Split_Point * parent{split_point.parent}; parent; parent = parent->parent)
+    {
+        if (parent == ancestor) { return true; }
+    }
+
+    return false;
+} // Is_Below
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Helper_Loop(S_Search_Thread & thread) noexcept
+{
+    std::unique_lock<std::mutex> lock(_threads_mutex);
+
+    while (true)
+    {
+        thread.idle = true;
+        ++_idle_threads;
+
+        _threads_condition.wait(lock, [this, &thread]() { return _quit || thread.assigned_split_point != nullptr; });
+
+        if (_quit) { return; }
+
+        S_Split_Point * const split_point{thread.assigned_split_point};
+        thread.assigned_split_point = nullptr;
+        lock.unlock();
+
+        // The split point may be destroyed as soon as the thread leaves it, it must not be used after Join_Split_Point
+        Join_Split_Point(thread, *split_point);
+
+        lock.lock();
+    }
+} // Helper_Loop
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Stop_Helper_Threads(void) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(_threads_mutex);
+        _quit = true;
+    }
+
+    _threads_condition.notify_all();
+
+    for (auto & thread : _threads)
+    {
+        if (thread->thread.joinable()) { thread->thread.join(); }
+    }
+} // Stop_Helper_Threads
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Make_Move(S_Search_Thread & thread, const unsigned int move, const E_Pawn_Color color) noexcept
+{
+    const S_Move_Undo & undo = thread.othellier.Make_Move(move, color);
+
+    if (_evaluation_weights) { thread.evaluator.Make_Move(move, undo.flips, color); }
+} // Make_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Search_Engine::Unmake_Move(S_Search_Thread & thread) noexcept
+{
+    thread.othellier.Unmake_Move();
+
+    if (_evaluation_weights) { thread.evaluator.Unmake_Move(); }
+} // Unmake_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Search_Engine::Evaluate(const S_Search_Thread & thread, const E_Pawn_Color color, const uint64_t player, const uint64_t opponent) const noexcept
+{
+    // Patterns : a prediction of the final difference, always under the score of a won game
+    if (_evaluation_weights)
+    {
+        const int score{thread.evaluator.Evaluate(*_evaluation_weights, color, Bitboard::Count_Bits(player | opponent))};
+        return std::max(-SCORE_FINAL_DISC + 1, std::min(SCORE_FINAL_DISC - 1, score));
+    }
+
+    int score{0};
+
+    for (uint64_t pawns{player}; pawns; pawns &= pawns - 1)     { score += square_values[Bitboard::First_Square(pawns)]; }
+    for (uint64_t pawns{opponent}; pawns; pawns &= pawns - 1)   { score -= square_values[Bitboard::First_Square(pawns)]; }
+
+    // Frontier : pawns next to an empty slot give moves to the other side
+    const uint64_t empty{~(player | opponent)};
+    score -= FRONTIER_VALUE * (static_cast<int>(Bitboard::Count_Bits(Bitboard::Get_Frontier_Pawns(player, empty)))
+                             - static_cast<int>(Bitboard::Count_Bits(Bitboard::Get_Frontier_Pawns(opponent, empty))));
+
+    // Mobility : the number of moves left to each side
+    score += MOBILITY_VALUE * (static_cast<int>(Bitboard::Count_Bits(Bitboard::Fast_Legal_Moves(player, opponent)))
+                             - static_cast<int>(Bitboard::Count_Bits(Bitboard::Fast_Legal_Moves(opponent, player))));
+
+    return score;
+} // Evaluate
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Search_Engine::Final_Score(const uint64_t player, const uint64_t opponent) const noexcept
+{
+    // Same rule as Count_All_Pawns : the empty slots are given to the winner
+    const int player_pawns  {static_cast<int>(Bitboard::Count_Bits(player))};
+    const int opponent_pawns{static_cast<int>(Bitboard::Count_Bits(opponent))};
+    const int empty_slots   {NUMBER_SQUARES - player_pawns - opponent_pawns};
+
+    int difference{player_pawns - opponent_pawns};
+
+    if      (difference > 0) { difference += empty_slots; }
+    else if (difference < 0) { difference -= empty_slots; }
+
+    return difference * SCORE_FINAL_DISC;
+} // Final_Score
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Search_Engine::Is_Time_Over(void) noexcept
+{
+    return _stop_requested || std::chrono::steady_clock::now().time_since_epoch().count() >= _deadline;
+} // Is_Time_Over
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
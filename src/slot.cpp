@@ -5,28 +5,16 @@
 
 #include "slot.h"
 
-#include <utility>
 #include <iostream>
 #include <stdexcept>
 
-/********************************************************************************************************************************************************************/
-/********************************************************************************************************************************************************************/
-/* Static Variables */
-/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
-
-unsigned int Slot::_number_of_slots = 0;
-unsigned int Slot::_number_of_slots_occupied = 0;
-
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 /* Classe Implementation */
 /*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-Slot::Slot()
+Slot::Slot() : _occupation(false), _pawn(E_Pawn_Color::BLACK)
 {
-    ++_number_of_slots;
-    _occupation = false;
-    _pawn = nullptr;
 } // Slot
 
 /********************************************************************************************************************************************************************/
@@ -34,7 +22,6 @@ Slot::Slot()
 
 Slot::~Slot()
 {
-    --_number_of_slots;
 } // ~Slot
 
 /********************************************************************************************************************************************************************/
@@ -50,11 +37,7 @@ bool Slot::Is_Empty(void) const noexcept
 
 void Slot::Set_Empty(void) noexcept
 {
-    if (_occupation)
-    {
-        --_number_of_slots_occupied;
-        _occupation = false;
-    }
+    _occupation = false;
 } // Set_Empty
 
 /********************************************************************************************************************************************************************/
@@ -64,18 +47,17 @@ void Slot::Occupy_Slot(Pawn pawn) noexcept
 {
     if (!_occupation)
     {
-        ++_number_of_slots_occupied;
         _occupation = true;
-        _pawn = std::make_unique<Pawn>( std::move(pawn) );
+        _pawn = pawn;
     }
 } // Occupy_Slot
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
 
-void Slot::Return_Pawn(void) const noexcept
+void Slot::Return_Pawn(void) noexcept
 {
-    if (_pawn) { _pawn->Return_Pawn(); } // Prevents a use of a non owned unique ptr (it means _pawn == nullptr so we cannot call the Return_Pawn method)
+    if (_occupation) { _pawn.Return_Pawn(); } // An empty slot has no pawn to return
 } // Return_Pawn
 
 /********************************************************************************************************************************************************************/
@@ -83,35 +65,11 @@ void Slot::Return_Pawn(void) const noexcept
 
 E_Pawn_Color Slot::Get_Pawn_Color(void) const
 {
-    if (_pawn) { return _pawn->Get_Color(); }
+    if (_occupation) { return _pawn.Get_Color(); }
 
-    std::cout << "Try to get the pawn color but pawn is nullptr" << std::endl;
-    throw std::runtime_error("Try to get the pawn color but pawn is nullptr");
+    std::cout << "Try to get the pawn color but the slot is empty" << std::endl;
+    throw std::runtime_error("Try to get the pawn color but the slot is empty");
 } // Get_Pawn_Color
 
 /********************************************************************************************************************************************************************/
 /********************************************************************************************************************************************************************/
-
-unsigned int Slot::Get_Number_of_Slots(void) noexcept
-{
-    return _number_of_slots;
-} // Get_Number_of_Slots
-
-/********************************************************************************************************************************************************************/
-/********************************************************************************************************************************************************************/
-
-unsigned int Slot::Get_Number_of_Occupied_Slots(void) noexcept
-{
-    return _number_of_slots_occupied;
-} // Get_Number_of_Occupied_Slots
-
-/********************************************************************************************************************************************************************/
-/********************************************************************************************************************************************************************/
-
-unsigned int Slot::Get_Number_of_Free_Slots(void) noexcept
-{
-    return _number_of_slots - _number_of_slots_occupied;
-} // Get_Number_of_Free_Slots
-
-/********************************************************************************************************************************************************************/
-/********************************************************************************************************************************************************************/
@@ -0,0 +1,181 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "terminal.h"
+
+#include <cstdio>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#if defined(_WIN32)
+Terminal::Terminal() : _raw_input(false), _input(GetStdHandle(STD_INPUT_HANDLE)), _output(GetStdHandle(STD_OUTPUT_HANDLE)), _saved_input_mode(0)
+#else
+Terminal::Terminal() : _raw_input(false), _saved_input_mode()
+#endif
+{
+} // Terminal
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Terminal::~Terminal()
+{
+    Set_Raw_Input(false);
+} // ~Terminal
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Terminal::Setup(const std::string & title) noexcept
+{
+#if defined(_WIN32)
+    // The Windows console only understands the ANSI sequences once enabled
+    DWORD mode{0};
+    if (!GetConsoleMode(_output, &mode) || !SetConsoleMode(_output, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING)) { return false; }
+#endif
+
+    Set_Title(title);
+
+    return true;
+} // Setup
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Terminal::Set_Title(const std::string & title) noexcept
+{
+    // OSC 0 : title of the window (and of the icon), understood by the Windows console too
+    const std::string sequence{"\x1b]0;" + title + "\x07"};
+    Write(sequence.data(), sequence.size());
+} // Set_Title
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Terminal::Clear_Screen(void) noexcept
+{
+    static const char sequence[]{"\x1b[H\x1b[2J"};
+    Write(sequence, sizeof(sequence) - 1);
+} // Clear_Screen
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Terminal::Move_Cursor(const unsigned int row, const unsigned int column) noexcept
+{
+    // ANSI rows and columns start at 1
+    char sequence[32];
+    const int size{std::snprintf(sequence, sizeof(sequence), "\x1b[%u;%uH", row + 1, column + 1)};
+
+    if (size > 0) { Write(sequence, static_cast<std::size_t>(size)); }
+} // Move_Cursor
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Terminal::Set_Raw_Input(const bool raw) noexcept
+{
+    if (raw == _raw_input) { return true; }
+
+#if defined(_WIN32)
+    if (raw)
+    {
+        if (!GetConsoleMode(_input, &_saved_input_mode)) { return false; }
+        if (!SetConsoleMode(_input, _saved_input_mode & ~(ENABLE_LINE_INPUT | ENABLE_ECHO_INPUT))) { return false; }
+    }
+    else if (!SetConsoleMode(_input, _saved_input_mode)) { return false; }
+#else
+    if (raw)
+    {
+        if (::tcgetattr(STDIN_FILENO, &_saved_input_mode) != 0) { return false; }
+
+        struct termios raw_mode{_saved_input_mode};
+        raw_mode.c_lflag &= ~static_cast<tcflag_t>(ICANON | ECHO);
+        raw_mode.c_cc[VMIN] = 1;
+        raw_mode.c_cc[VTIME] = 0;
+
+        if (::tcsetattr(STDIN_FILENO, TCSANOW, &raw_mode) != 0) { return false; }
+    }
+    else if (::tcsetattr(STDIN_FILENO, TCSANOW, &_saved_input_mode) != 0) { return false; }
+#endif
+
+    _raw_input = raw;
+    return true;
+} // Set_Raw_Input
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+int Terminal::Read_Key(const int timeout_ms) noexcept
+{
+#if defined(_WIN32)
+    // Only the key presses which give a character are keys, the other events of the console are skipped
+    while (WaitForSingleObject(_input, timeout_ms < 0 ? INFINITE : static_cast<DWORD>(timeout_ms)) == WAIT_OBJECT_0)
+    {
+        INPUT_RECORD record;
+        DWORD number_of_records{0};
+
+        if (!ReadConsoleInputA(_input, &record, 1, &number_of_records) || number_of_records == 0) { return NO_KEY; }
+
+        if (record.EventType == KEY_EVENT && record.Event.KeyEvent.bKeyDown && record.Event.KeyEvent.uChar.AsciiChar != 0)
+        {
+            return static_cast<unsigned char>(record.Event.KeyEvent.uChar.AsciiChar);
+        }
+    }
+
+    return NO_KEY;
+#else
+    struct pollfd input{STDIN_FILENO, POLLIN, 0};
+    int ready;
+
+    do { ready = ::poll(&input, 1, timeout_ms); } while (ready < 0 && errno == EINTR);
+    if (ready <= 0) { return NO_KEY; }
+
+    unsigned char key;
+    return ::read(STDIN_FILENO, &key, 1) == 1 ? key : NO_KEY;
+#endif
+} // Read_Key
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Terminal::Write(const char * data, const std::size_t size) noexcept
+{
+    // What std::cout holds must be written first, to keep the order of the text
+    std::fflush(stdout);
+
+    for (std::size_t written{0}; written < size; )
+    {
+#if defined(_WIN32)
+        DWORD count{0};
+        if (!WriteFile(_output, data + written, static_cast<DWORD>(size - written), &count, nullptr)) { return false; }
+#else
+        const ssize_t count{::write(STDOUT_FILENO, data + written, size - written)};
+
+        if (count < 0)
+        {
+            if (errno == EINTR) { continue; }
+            return false;
+        }
+#endif
+        written += static_cast<std::size_t>(count);
+    }
+
+    return true;
+} // Write
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
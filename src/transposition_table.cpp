@@ -0,0 +1,214 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "transposition_table.h"
+
+#include <climits>
+#include <cstdint>
+#include <new>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Layout of the data of an entry
+#define SCORE_BITS          0       // 32 bits, signed
+#define DEPTH_BITS          32      // 8 bits
+#define BOUND_BITS          40      // 2 bits
+#define MOVE_BITS           42      // 7 bits
+#define GENERATION_BITS     56      // 8 bits
+
+#define USAGE_SAMPLE        1000    // Number of buckets read by Get_Usage_Permille
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Classe Implementation */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+Transposition_Table::Transposition_Table(const std::size_t size_mb) : _buckets(nullptr), _number_of_buckets(0), _generation(0)
+{
+    Resize(size_mb);
+} // Transposition_Table
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+Transposition_Table::~Transposition_Table()
+{
+} // ~Transposition_Table
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Transposition_Table::Resize(const std::size_t size_mb)
+{
+    // Greatest power of two of buckets which fits in the size asked (at least one bucket)
+    const std::size_t size_bytes{size_mb * 1024 * 1024};
+    std::size_t number_of_buckets{1};
+
+    while (number_of_buckets * 2 * sizeof(S_Hash_Bucket) <= size_bytes) { number_of_buckets *= 2; }
+
+    if (number_of_buckets != _number_of_buckets)
+    {
+        // operator new doesn't align on a cache line before C++17 : the buckets are built in a buffer aligned by hand
+        _memory.reset(new char[number_of_buckets * sizeof(S_Hash_Bucket) + alignof(S_Hash_Bucket)]);
+
+        const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(_memory.get())};
+        _buckets = reinterpret_cast<S_Hash_Bucket *>((address + alignof(S_Hash_Bucket) - 1) & ~static_cast<std::uintptr_t>(alignof(S_Hash_Bucket) - 1));
+
+        for (std::size_t index{0}; index < number_of_buckets; ++index) { new (&_buckets[index]) S_Hash_Bucket; }
+
+        _number_of_buckets = number_of_buckets;
+    }
+
+    Clear();
+} // Resize
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Transposition_Table::Clear(void) noexcept
+{
+    for (std::size_t index{0}; index < _number_of_buckets; ++index)
+    {
+        for (unsigned int entry{0}; entry < ENTRIES_PER_BUCKET; ++entry)
+        {
+            _buckets[index].keys[entry].store(0, std::memory_order_relaxed);
+            _buckets[index].datas[entry].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    _generation = 0;
+} // Clear
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Transposition_Table::New_Search(void) noexcept
+{
+    _generation = (_generation + 1) & 0xFF;
+} // New_Search
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+bool Transposition_Table::Probe(const uint64_t key, S_Hash_Entry & entry) const noexcept
+{
+    const S_Hash_Bucket & bucket = _buckets[key & (_number_of_buckets - 1)];
+
+    for (unsigned int index{0}; index < ENTRIES_PER_BUCKET; ++index)
+    {
+        const uint64_t data{bucket.datas[index].load(std::memory_order_relaxed)};
+
+        if (data != 0 && (bucket.keys[index].load(std::memory_order_relaxed) ^ data) == key)
+        {
+            entry = Unpack(data);
+            return true;
+        }
+    }
+
+    return false;
+} // Probe
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Transposition_Table::Store(const uint64_t key, const unsigned int depth, const E_Bound_Type bound, const int score, const unsigned int best_move) noexcept
+{
+    S_Hash_Bucket & bucket = _buckets[key & (_number_of_buckets - 1)];
+
+    unsigned int replaced{0};
+    int lowest_priority{INT_MAX};
+
+    for (unsigned int index{0}; index < ENTRIES_PER_BUCKET; ++index)
+    {
+        const uint64_t data{bucket.datas[index].load(std::memory_order_relaxed)};
+
+        // Same position : always updated, but the best move already known is kept if the new search has none
+        if (data != 0 && (bucket.keys[index].load(std::memory_order_relaxed) ^ data) == key)
+        {
+            const unsigned int move{best_move < 64 ? best_move : Unpack(data).best_move};
+            const uint64_t new_data{Pack(depth, bound, score, move, _generation)};
+
+            bucket.keys[index].store(key ^ new_data, std::memory_order_relaxed);
+            bucket.datas[index].store(new_data, std::memory_order_relaxed);
+            return;
+        }
+
+        // Otherwise the entry replaced is the cheapest to search again : empty, then old, then shallow
+        const unsigned int age{(_generation - static_cast<unsigned int>(data >> GENERATION_BITS)) & 0xFF};
+        const int priority{data == 0 ? INT_MIN : static_cast<int>(Unpack(data).depth) - 8 * static_cast<int>(age)};
+
+        if (priority < lowest_priority)
+        {
+            lowest_priority = priority;
+            replaced = index;
+        }
+    }
+
+    const uint64_t new_data{Pack(depth, bound, score, best_move, _generation)};
+
+    bucket.keys[replaced].store(key ^ new_data, std::memory_order_relaxed);
+    bucket.datas[replaced].store(new_data, std::memory_order_relaxed);
+} // Store
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+std::size_t Transposition_Table::Get_Size_MB(void) const noexcept
+{
+    return _number_of_buckets * sizeof(S_Hash_Bucket) / (1024 * 1024);
+} // Get_Size_MB
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+unsigned int Transposition_Table::Get_Usage_Permille(void) const noexcept
+{
+    const std::size_t sample{_number_of_buckets < USAGE_SAMPLE ? _number_of_buckets : USAGE_SAMPLE};
+    std::size_t used{0};
+
+    for (std::size_t index{0}; index < sample; ++index)
+    {
+        for (unsigned int entry{0}; entry < ENTRIES_PER_BUCKET; ++entry)
+        {
+            const uint64_t data{_buckets[index].datas[entry].load(std::memory_order_relaxed)};
+            if (data != 0 && (data >> GENERATION_BITS) == _generation) { ++used; }
+        }
+    }
+
+    return static_cast<unsigned int>(used * 1000 / (sample * ENTRIES_PER_BUCKET));
+} // Get_Usage_Permille
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+uint64_t Transposition_Table::Pack(const unsigned int depth, const E_Bound_Type bound, const int score, const unsigned int best_move, const unsigned int generation) noexcept
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(score))        << SCORE_BITS)
+         | (static_cast<uint64_t>(depth & 0xFF)                         << DEPTH_BITS)
+         | (static_cast<uint64_t>(static_cast<int>(bound) & 0x3)        << BOUND_BITS)
+         | (static_cast<uint64_t>(best_move & 0x7F)                     << MOVE_BITS)
+         | (static_cast<uint64_t>(generation & 0xFF)                    << GENERATION_BITS);
+} // Pack
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+S_Hash_Entry Transposition_Table::Unpack(const uint64_t data) noexcept
+{
+    S_Hash_Entry entry;
+
+    entry.score     = static_cast<int>(static_cast<uint32_t>(data >> SCORE_BITS));
+    entry.depth     = static_cast<unsigned int>((data >> DEPTH_BITS) & 0xFF);
+    entry.bound     = static_cast<E_Bound_Type>((data >> BOUND_BITS) & 0x3);
+    entry.best_move = static_cast<unsigned int>((data >> MOVE_BITS) & 0x7F);
+
+    return entry;
+} // Unpack
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
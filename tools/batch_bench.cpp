@@ -0,0 +1,137 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_kernels.h"
+#include "bitboard_othellier.h"
+#include "position_batch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_NUMBER_OF_POSITIONS     1000000
+#define DEFAULT_NUMBER_OF_ROUNDS        20
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Utility Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Every position of random games with a fixed seed, from the color to play, until the batch is full
+void Fill_Bench_Batch(Position_Batch & batch, const std::size_t number_of_positions)
+{
+    std::mt19937 generator{2017};
+
+    while (batch.Get_Size() < number_of_positions)
+    {
+        Bitboard_Othellier othellier;
+        E_Pawn_Color color{E_Pawn_Color::BLACK};
+        bool passed{false};
+
+        while (batch.Get_Size() < number_of_positions)
+        {
+            batch.Add(othellier, color);
+
+            uint64_t moves{othellier.Generate_Legal_Moves(color)};
+
+            if (!moves)
+            {
+                if (passed) { break; }
+                passed = true;
+            }
+            else
+            {
+                for (unsigned int skipped{static_cast<unsigned int>(generator() % Bitboard::Count_Bits(moves))}; skipped > 0; --skipped) { moves &= moves - 1; }
+                othellier.Make_Move(Bitboard::First_Square(moves), color);
+                passed = false;
+            }
+
+            color = Get_Opponent_Color(color);
+        }
+    }
+} // Fill_Bench_Batch
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : batch_bench [number of positions] [rounds]
+// Evaluates the same batch with every kernel the processor supports, checks the results against the scalar ones and reports the positions per second
+int main(int argc, char * argv[])
+{
+    const std::size_t number_of_positions{argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : DEFAULT_NUMBER_OF_POSITIONS};
+    const unsigned int number_of_rounds{argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : DEFAULT_NUMBER_OF_ROUNDS};
+
+    Position_Batch batch{number_of_positions};
+    bool all_exact{true};
+
+    Fill_Bench_Batch(batch, number_of_positions);
+
+    // Reference results : the scalar functions of bitboard.h, one position at a time
+    std::vector<uint64_t> legal_moves(batch.Get_Size());
+    std::vector<uint8_t> mobilities(batch.Get_Size());
+    std::vector<uint8_t> player_pawns(batch.Get_Size());
+    std::vector<uint8_t> opponent_pawns(batch.Get_Size());
+
+    for (std::size_t index{0}; index < batch.Get_Size(); ++index)
+    {
+        legal_moves[index]    = Bitboard::Get_Legal_Moves(batch.Get_Players()[index], batch.Get_Opponents()[index]);
+        mobilities[index]     = static_cast<uint8_t>(Bitboard::Count_Bits(legal_moves[index]));
+        player_pawns[index]   = static_cast<uint8_t>(Bitboard::Count_Bits(batch.Get_Players()[index]));
+        opponent_pawns[index] = static_cast<uint8_t>(Bitboard::Count_Bits(batch.Get_Opponents()[index]));
+    }
+
+    // Results of the kernels, cleared before each one : the arrays are given directly to Evaluate_Batch
+    std::vector<uint64_t> batch_legal_moves(batch.Get_Size());
+    std::vector<uint8_t> batch_mobilities(batch.Get_Size());
+    std::vector<uint8_t> batch_player_pawns(batch.Get_Size());
+    std::vector<uint8_t> batch_opponent_pawns(batch.Get_Size());
+    const S_Batch_Arrays arrays{batch.Get_Size(), batch.Get_Players(), batch.Get_Opponents(),
+                                batch_legal_moves.data(), batch_mobilities.data(), batch_player_pawns.data(), batch_opponent_pawns.data()};
+
+    std::cout << "Batch bench : " << batch.Get_Size() << " positions, " << number_of_rounds << " rounds" << std::endl;
+    std::cout << "kernels        time (ms)     positions/s" << std::endl;
+
+    for (const E_Kernel_Type type : {E_Kernel_Type::SCALAR, E_Kernel_Type::AVX2, E_Kernel_Type::AVX512})
+    {
+        if (!Bitboard::Select_Kernels(type)) { continue; }
+
+        std::fill(batch_legal_moves.begin(), batch_legal_moves.end(), 0);
+        std::fill(batch_mobilities.begin(), batch_mobilities.end(), 0);
+        std::fill(batch_player_pawns.begin(), batch_player_pawns.end(), 0);
+        std::fill(batch_opponent_pawns.begin(), batch_opponent_pawns.end(), 0);
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (unsigned int round{0}; round < number_of_rounds; ++round) { Evaluate_Batch(arrays); }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const bool exact{legal_moves == batch_legal_moves && mobilities == batch_mobilities && player_pawns == batch_player_pawns && opponent_pawns == batch_opponent_pawns};
+
+        all_exact = all_exact && exact;
+
+        std::cout << std::setw(7)  << Bitboard::Get_Kernel_Name(type)
+                  << std::setw(17) << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()
+                  << std::setw(16) << static_cast<unsigned long long>(batch.Get_Size() * number_of_rounds / (std::chrono::duration<double>(elapsed).count() + 1e-9))
+                  << (exact ? "" : "   WRONG RESULTS") << std::endl;
+    }
+
+    return all_exact ? 0 : 1;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,237 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_kernels.h"
+#include "bitboard_othellier.h"
+#include "opening_book.h"
+#include "search.h"
+#include "symmetry.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_BOOK_PLIES          12
+#define DEFAULT_BOOK_DEPTH          8
+#define DEFAULT_FULL_WIDTH_PLIES    4       // Every move is expanded up to this ply, only the best ones after it
+#define DEFAULT_BOOK_MARGIN         0       // Moves expanded after the full width plies : score at most this far from the best one
+#define BOOK_HASH_SIZE_MB           64
+#define PROGRESS_POSITIONS          100
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+struct S_Book_Settings
+{
+    unsigned int    plies;      // Positions with less pawns placed than this since the start are in the book
+    unsigned int    depth;
+    unsigned int    full_width_plies;
+    int             margin;
+};
+
+struct S_Book_Builder
+{
+    S_Book_Settings                             settings;
+    Search_Engine &                             search_engine;
+    Bitboard_Othellier                          othellier;
+    std::unordered_map<uint64_t, S_Book_Entry>  entries;
+    std::vector< std::pair<uint64_t, uint64_t> > positions;    // Player and opponent pawns of each entry, to check the book once written
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Utility Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Score of the move for the color which plays it, searched one ply less deep than the position
+int Score_Move(S_Book_Builder & builder, const unsigned int move, const E_Pawn_Color color)
+{
+    const E_Pawn_Color opponent_color{Get_Opponent_Color(color)};
+    int score{0};
+
+    builder.othellier.Make_Move(move, color);
+
+    if (builder.othellier.Generate_Legal_Moves(opponent_color))
+    {
+        score = -builder.search_engine.Search(builder.othellier, opponent_color, NO_TIME_LIMIT_MS, builder.settings.depth - 1).score;
+    }
+    else if (builder.othellier.Generate_Legal_Moves(color))
+    {
+        // The opponent passes
+        score = builder.search_engine.Search(builder.othellier, color, NO_TIME_LIMIT_MS, builder.settings.depth - 1).score;
+    }
+    else
+    {
+        const int player_pawns  {static_cast<int>(Bitboard::Count_Bits(builder.othellier.Get_Pawns(color)))};
+        const int opponent_pawns{static_cast<int>(Bitboard::Count_Bits(builder.othellier.Get_Opponent_Pawns(color)))};
+
+        score = (player_pawns - opponent_pawns) * SCORE_FINAL_DISC;
+    }
+
+    builder.othellier.Unmake_Move();
+
+    return score;
+} // Score_Move
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Depth first expansion : the position gets its best move, then the moves kept are expanded - a position reached again by another order is not searched twice
+void Expand_Position(S_Book_Builder & builder, const E_Pawn_Color color)
+{
+    const uint64_t player  {builder.othellier.Get_Pawns(color)};
+    const uint64_t opponent{builder.othellier.Get_Opponent_Pawns(color)};
+    const unsigned int ply{Bitboard::Count_Bits(player | opponent) - 4};
+
+    if (ply >= builder.settings.plies) { return; }
+
+    const uint64_t moves{Bitboard::Fast_Legal_Moves(player, opponent)};
+
+    if (!moves)
+    {
+        if (Bitboard::Fast_Legal_Moves(opponent, player)) { Expand_Position(builder, Get_Opponent_Color(color)); }
+        return;
+    }
+
+    unsigned int transform{0};
+    const uint64_t key{Get_Book_Key(player, opponent, transform)};
+
+    if (builder.entries.count(key)) { return; }
+
+    std::vector< std::pair<unsigned int, int> > scored_moves;
+    int best_score{-SCORE_INFINITE};
+    unsigned int best_move{NO_MOVE};
+
+    for (uint64_t remaining{moves}; remaining; remaining &= remaining - 1)
+    {
+        const unsigned int move{Bitboard::First_Square(remaining)};
+        const int score{Score_Move(builder, move, color)};
+
+        scored_moves.emplace_back(move, score);
+
+        if (score > best_score)
+        {
+            best_score = score;
+            best_move = move;
+        }
+    }
+
+    builder.entries[key] = S_Book_Entry{key, best_score, Bitboard::Transform_Square(best_move, transform), builder.settings.depth};
+    builder.positions.emplace_back(player, opponent);
+
+    if (builder.entries.size() % PROGRESS_POSITIONS == 0) { std::cout << builder.entries.size() << " positions..." << std::endl; }
+
+    for (const auto & scored_move : scored_moves)
+    {
+        if (ply >= builder.settings.full_width_plies && scored_move.second < best_score - builder.settings.margin) { continue; }
+
+        builder.othellier.Make_Move(scored_move.first, color);
+        Expand_Position(builder, Get_Opponent_Color(color));
+        builder.othellier.Unmake_Move();
+    }
+} // Expand_Position
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Every position expanded must be found, with its best move legal in the position probed
+bool Check_Book(const std::string & path, const S_Book_Builder & builder)
+{
+    Opening_Book book;
+
+    if (!book.Open(path) || book.Get_Number_of_Entries() != builder.entries.size())
+    {
+        std::cerr << "Can't read the book " << path << std::endl;
+        return false;
+    }
+
+    unsigned long long wrong_positions{0};
+    S_Book_Entry entry;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const auto & position : builder.positions)
+    {
+        if (!book.Probe(position.first, position.second, entry)
+            || !(Bitboard::Fast_Legal_Moves(position.first, position.second) & Bitboard::Square_Bit(entry.move)))
+        {
+            ++wrong_positions;
+        }
+    }
+
+    const double elapsed_us{std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count()};
+
+    std::cout << "lookups : " << elapsed_us / (builder.positions.size() ? builder.positions.size() : 1) << " us per position, "
+              << wrong_positions << " positions not found or with an illegal move" << std::endl;
+
+    return wrong_positions == 0;
+} // Check_Book
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : book_builder [output file] [plies] [depth] [full width plies] [margin]
+// Expands the positions from the starting position : every move up to the full width plies, then only the moves scored at most margin under the best one
+// Each position gets the best move of a search (every move is searched at depth - 1), the book is written sorted by key then read again to check it
+int main(int argc, char * argv[])
+{
+    const std::string output_file{argc > 1 ? argv[1] : DEFAULT_OPENING_BOOK_FILE};
+    const S_Book_Settings settings{argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : DEFAULT_BOOK_PLIES,
+                                   argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : DEFAULT_BOOK_DEPTH,
+                                   argc > 4 ? static_cast<unsigned int>(std::atoi(argv[4])) : DEFAULT_FULL_WIDTH_PLIES,
+                                   argc > 5 ? std::atoi(argv[5]) : DEFAULT_BOOK_MARGIN};
+
+    if (settings.depth < 2)
+    {
+        std::cerr << "The depth must be at least 2" << std::endl;
+        return 1;
+    }
+
+    const unsigned int hardware_threads{std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1};
+    Search_Engine search_engine{hardware_threads, BOOK_HASH_SIZE_MB};
+    S_Book_Builder builder{settings, search_engine, Bitboard_Othellier{}, {}, {}};
+
+    std::cout << "kernels : " << Bitboard::Get_Kernel_Name(Bitboard::kernels.type) << ", " << hardware_threads << " search threads" << std::endl;
+    std::cout << "plies " << settings.plies << ", depth " << settings.depth << ", full width plies " << settings.full_width_plies << ", margin " << settings.margin << std::endl;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    builder.othellier.Reset_Othellier();
+    Expand_Position(builder, E_Pawn_Color::BLACK);
+
+    const double elapsed_s{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+    std::vector<S_Book_Entry> entries;
+    entries.reserve(builder.entries.size());
+    for (const auto & entry : builder.entries) { entries.push_back(entry.second); }
+
+    if (!Write_Opening_Book(output_file, entries))
+    {
+        std::cerr << "Can't write the book " << output_file << std::endl;
+        return 1;
+    }
+
+    std::cout << entries.size() << " positions written in " << output_file << " (" << elapsed_s << " s)" << std::endl;
+
+    return Check_Book(output_file, builder) ? 0 : 1;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,94 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_kernels.h"
+#include "endgame.h"
+
+#include <array>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+struct S_Bench_Position
+{
+    const char *    name;
+    const char *    othellier;      // 64 slots from X = 1, Y = 1 to X = 8, Y = 8 : 'X' black, 'O' white, '-' empty
+    char            color;          // Color to play
+    int             score;          // Known exact score
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Variables */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// FFO endgame test suite, positions 40 to 42 (20 and 22 empty slots)
+static const std::array<S_Bench_Position, 3> bench_positions
+{{
+    {"FFO #40", "O--OOOOX-OOOOOOXOOXXOOOXOOXOOOXXOOOOOOXX---OOOOX----O--X--------", 'X',  38},
+    {"FFO #41", "-OOOOO----OOOOX--OOOOOO-XXXXXOO--XXOOX--OOXOXX----OXXO---OOO--O-", 'X',   0},
+    {"FFO #42", "--OOO-------XX-OOOOOOXOO-OOOOXOOX-OOOXXO---OOXOO---OOOXO--OOOO--", 'X',   6}
+}};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : endgame_bench [number of positions]
+// Solves the positions one after the other and checks each score against the known one
+int main(int argc, char * argv[])
+{
+    const std::size_t number_of_positions{argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : bench_positions.size()};
+
+    Endgame_Solver endgame_solver;
+    unsigned long long total_nodes{0};
+    unsigned long long total_ms{0};
+    bool all_exact{true};
+
+    std::cout << "Endgame bench, " << Bitboard::Get_Kernel_Name(Bitboard::kernels.type) << " kernels" << std::endl;
+    std::cout << "position  empties  score  move        nodes   time (ms)       nodes/s" << std::endl;
+
+    for (std::size_t index{0}; index < number_of_positions && index < bench_positions.size(); ++index)
+    {
+        const S_Bench_Position & position = bench_positions[index];
+        uint64_t black_pawns{0};
+        uint64_t white_pawns{0};
+
+        for (unsigned int square{0}; square < NUMBER_SQUARES; ++square)
+        {
+            if (position.othellier[square] == 'X') { black_pawns |= Bitboard::Square_Bit(square); }
+            if (position.othellier[square] == 'O') { white_pawns |= Bitboard::Square_Bit(square); }
+        }
+
+        const S_Endgame_Result result{position.color == 'X' ? endgame_solver.Solve(black_pawns, white_pawns) : endgame_solver.Solve(white_pawns, black_pawns)};
+
+        total_nodes += result.nodes;
+        total_ms += result.elapsed_ms;
+        all_exact = all_exact && result.score == position.score;
+
+        std::cout << std::setw(8)  << position.name
+                  << std::setw(9)  << result.empties
+                  << std::setw(7)  << result.score
+                  << std::setw(5)  << static_cast<char>('a' + result.best_move % 8) << result.best_move / 8 + 1
+                  << std::setw(13) << result.nodes
+                  << std::setw(12) << result.elapsed_ms
+                  << std::setw(14) << result.nodes_per_second
+                  << (result.score == position.score ? "" : "   WRONG SCORE") << std::endl;
+    }
+
+    std::cout << "Total : " << total_nodes << " nodes in " << total_ms << " ms" << std::endl;
+
+    return all_exact ? 0 : 1;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
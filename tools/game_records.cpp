@@ -0,0 +1,202 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_othellier.h"
+#include "game_record.h"
+#include "othellier.h"
+#include "symmetry.h"
+#include "zobrist.h"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Utility Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Plays the moves of the game from the starting position : false if one of them is not legal, or if the pawns at the end are not the ones recorded
+bool Replay_Game(const S_Game_Record_View & game)
+{
+    Bitboard_Othellier othellier;
+    E_Pawn_Color color{E_Pawn_Color::BLACK};
+
+    for (unsigned int index{0}; index < game.number_of_moves; ++index)
+    {
+        const unsigned int move{game.moves[index]};
+
+        if (move == PASS_MOVE)
+        {
+            if (othellier.Generate_Legal_Moves(color)) { return false; }
+        }
+        else if (move >= NUMBER_SQUARES || !othellier.Place_Pawn(move % NUMBER_COLUMNS + 1, move / NUMBER_COLUMNS + 1, Pawn{ color }))
+        {
+            return false;
+        }
+
+        color = Get_Opponent_Color(color);
+    }
+
+    return othellier.Count_All_Pawns() == game.pawns;
+} // Replay_Game
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+void Display_Game(const std::size_t number, const S_Game_Record_View & game)
+{
+    std::cout << "game " << number << " : player 1 (black) " << game.player_1 << ", player 2 (white) " << game.player_2
+              << ", result " << static_cast<int>(game.result) << ", pawns " << game.pawns.first << " - " << game.pawns.second
+              << ", timestamp " << game.timestamp << std::endl;
+
+    for (unsigned int index{0}; index < game.number_of_moves; ++index)
+    {
+        if (game.moves[index] == PASS_MOVE) { std::cout << "--"; }
+        else                                { std::cout << static_cast<char>('a' + game.moves[index] % NUMBER_COLUMNS) << static_cast<char>('1' + game.moves[index] / NUMBER_COLUMNS); }
+    }
+
+    std::cout << std::endl;
+} // Display_Game
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Every position reached by the games (color to play, before its move), kept once for all its symmetries : the dedupe of a training set
+// Returns the number of positions read, unique_positions counts the positions without any symmetry already kept, raw_positions the ones never seen as they are
+unsigned long long Count_Unique_Positions(const Game_Record_Reader & reader, unsigned long long & unique_positions, unsigned long long & raw_positions)
+{
+    std::unordered_set<uint64_t> canonical_keys;
+    std::unordered_set<uint64_t> raw_keys;
+    unsigned long long number_of_positions{0};
+    std::size_t offset{0};
+    S_Game_Record_View game;
+
+    while (reader.Next_Game(offset, game))
+    {
+        Bitboard_Othellier othellier;
+        E_Pawn_Color color{E_Pawn_Color::BLACK};
+
+        othellier.Reset_Othellier();
+
+        for (unsigned int index{0}; index < game.number_of_moves && game.moves[index] <= PASS_MOVE; ++index)
+        {
+            const uint64_t player  {othellier.Get_Pawns(color)};
+            const uint64_t opponent{othellier.Get_Opponent_Pawns(color)};
+            const S_Canonical_Position canonical{Bitboard::Canonicalize(player, opponent)};
+
+            ++number_of_positions;
+            canonical_keys.insert(Compute_Hash_Key(canonical.player, canonical.opponent));
+            raw_keys.insert(Compute_Hash_Key(player, opponent));
+
+            if (game.moves[index] != PASS_MOVE)
+            {
+                if (!(othellier.Generate_Legal_Moves(color) & Bitboard::Square_Bit(game.moves[index]))) { break; }
+                othellier.Make_Move(game.moves[index], color);
+            }
+
+            color = Get_Opponent_Color(color);
+        }
+    }
+
+    unique_positions = canonical_keys.size();
+    raw_positions = raw_keys.size();
+
+    return number_of_positions;
+} // Count_Unique_Positions
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : game_records <archive> [game | check | positions]
+// Without option, reads every game of the archive and displays the results and the reading speed
+// With a game number, displays this game (found through the index) ; with check, also replays every game to check its moves
+// With positions, counts the positions of the games once each, with and without their symmetries
+int main(int argc, char * argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage : game_records <archive> [game | check | positions]" << std::endl;
+        return 1;
+    }
+
+    Game_Record_Reader reader;
+
+    if (!reader.Open(argv[1]))
+    {
+        std::cerr << "Can't read the archive " << argv[1] << std::endl;
+        return 1;
+    }
+
+    const bool check{argc > 2 && std::strcmp(argv[2], "check") == 0};
+
+    if (argc > 2 && std::strcmp(argv[2], "positions") == 0)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        unsigned long long unique_positions{0};
+        unsigned long long raw_positions{0};
+        const unsigned long long number_of_positions{Count_Unique_Positions(reader, unique_positions, raw_positions)};
+
+        const double elapsed_s{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+        std::cout << number_of_positions << " positions, " << raw_positions << " different, " << unique_positions << " different once the symmetries are removed ("
+                  << static_cast<double>(raw_positions) / (unique_positions ? unique_positions : 1) << "x less), in " << elapsed_s * 1000 << " ms" << std::endl;
+        return 0;
+    }
+
+    if (argc > 2 && !check)
+    {
+        const std::size_t number{static_cast<std::size_t>(std::atoll(argv[2]))};
+
+        if (number >= reader.Get_Number_of_Games())
+        {
+            std::cerr << "The archive has " << reader.Get_Number_of_Games() << " games" << std::endl;
+            return 1;
+        }
+
+        Display_Game(number, reader.Get_Game(number));
+        return 0;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::array<unsigned long long, 7> results{};   // Index : E_Game_Result
+    unsigned long long number_of_games{0};
+    unsigned long long number_of_moves{0};
+    unsigned long long wrong_games{0};
+    std::size_t offset{0};
+    S_Game_Record_View game;
+
+    while (reader.Next_Game(offset, game))
+    {
+        ++number_of_games;
+        number_of_moves += game.number_of_moves;
+        if (static_cast<std::size_t>(game.result) < results.size()) { ++results[static_cast<std::size_t>(game.result)]; }
+        if (check && !Replay_Game(game))                            { ++wrong_games; }
+    }
+
+    const double elapsed_s{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+    std::cout << number_of_games << " games (" << reader.Get_Number_of_Games() << " indexed), " << (number_of_games ? number_of_moves / number_of_games : 0) << " moves per game" << std::endl;
+    std::cout << "player 1 wins " << results[static_cast<int>(E_Game_Result::PLAYER_1_WIN)] + results[static_cast<int>(E_Game_Result::PLAYER_2_QUIT)]
+              << ", player 2 wins " << results[static_cast<int>(E_Game_Result::PLAYER_2_WIN)] + results[static_cast<int>(E_Game_Result::PLAYER_1_QUIT)]
+              << ", draws " << results[static_cast<int>(E_Game_Result::DRAW)] << std::endl;
+    std::cout << "read in " << elapsed_s * 1000 << " ms : " << static_cast<unsigned long long>(number_of_games / (elapsed_s + 1e-9)) << " games/s" << std::endl;
+
+    if (check) { std::cout << wrong_games << " games with illegal moves or wrong pawns" << std::endl; }
+
+    return wrong_games == 0 ? 0 : 1;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
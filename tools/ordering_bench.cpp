@@ -0,0 +1,140 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_othellier.h"
+#include "move_ordering.h"
+#include "search.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define NUMBER_OF_POSITIONS     20
+#define PLIES_BEFORE_SEARCH     20      // Same positions as search_bench
+#define DEFAULT_BENCH_DEPTH     8
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+struct S_Ordering_Configuration
+{
+    const char *                name;
+    S_Move_Ordering_Settings    settings;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Variables */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Each configuration adds one part of the order to the previous one : the first is the order of the squares, the second the order before move_ordering.h
+static const std::vector<S_Ordering_Configuration> configurations
+{
+    {"squares (A1, B1...)",     {false, false, false, false}},
+    {"+ hash move",             {true,  false, false, false}},
+    {"+ square priorities",     {true,  false, false, true }},
+    {"+ history",               {true,  false, true,  true }},
+    {"+ killers",               {true,  true,  true,  true }}
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Utility Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Always the same positions : random games with a fixed seed (std::mt19937 gives the same sequence on every platform)
+std::vector< std::pair<Bitboard_Othellier, E_Pawn_Color> > Create_Bench_Positions(void)
+{
+    std::vector< std::pair<Bitboard_Othellier, E_Pawn_Color> > positions;
+    std::mt19937 generator{2017};
+
+    while (positions.size() < NUMBER_OF_POSITIONS)
+    {
+        Bitboard_Othellier othellier;
+        E_Pawn_Color color{E_Pawn_Color::BLACK};
+
+        for (unsigned int ply{0}; ply < PLIES_BEFORE_SEARCH; ++ply)
+        {
+            uint64_t moves{othellier.Generate_Legal_Moves(color)};
+
+            if (moves)
+            {
+                for (unsigned int skip{static_cast<unsigned int>(generator() % Bitboard::Count_Bits(moves))}; skip > 0; --skip) { moves &= moves - 1; }
+                othellier.Make_Move(Bitboard::First_Square(moves), color);
+            }
+
+            color = Get_Opponent_Color(color);
+        }
+
+        if (othellier.Generate_Legal_Moves(color)) { positions.emplace_back(othellier, color); }
+    }
+
+    return positions;
+} // Create_Bench_Positions
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : ordering_bench [depth] [threads]
+// Searches the same positions to a fixed depth with more and more of the move ordering, and reports the nodes saved by each part
+// One thread by default : with more, the number of nodes depends on the timing of the threads
+int main(int argc, char * argv[])
+{
+    const unsigned int depth            {argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : DEFAULT_BENCH_DEPTH};
+    const unsigned int number_of_threads{argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 1};
+
+    const auto positions = Create_Bench_Positions();
+    Search_Engine search_engine{number_of_threads};
+    unsigned long long reference_nodes{0};
+    unsigned long long previous_nodes{0};
+
+    std::cout << "Ordering bench : " << positions.size() << " positions, depth " << depth << ", " << search_engine.Get_Number_of_Threads() << " threads" << std::endl;
+    std::cout << "order                     time (ms)        nodes   vs squares vs previous" << std::endl;
+
+    for (const S_Ordering_Configuration & configuration : configurations)
+    {
+        unsigned long long nodes{0};
+        unsigned long long elapsed_ms{0};
+
+        search_engine.Set_Move_Ordering(configuration.settings);
+
+        for (const auto & position : positions)
+        {
+            // Each position starts without hash table, killers or history
+            search_engine.Clear_Hash();
+            const S_Search_Result result{search_engine.Search(position.first, position.second, NO_TIME_LIMIT_MS, depth)};
+            nodes += result.nodes;
+            elapsed_ms += result.elapsed_ms;
+        }
+
+        if (reference_nodes == 0) { reference_nodes = nodes; }
+        if (previous_nodes == 0)  { previous_nodes = nodes; }
+
+        std::cout << std::left << std::setw(22) << configuration.name << std::right
+                  << std::setw(13) << elapsed_ms
+                  << std::setw(13) << nodes
+                  << std::setw(12) << std::fixed << std::setprecision(1) << 100.0 * (static_cast<double>(nodes) - reference_nodes) / reference_nodes << "%"
+                  << std::setw(12) << 100.0 * (static_cast<double>(nodes) - previous_nodes) / previous_nodes << "%" << std::endl;
+
+        previous_nodes = nodes;
+    }
+
+    return 0;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
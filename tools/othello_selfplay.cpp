@@ -0,0 +1,382 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "ai_player.h"
+#include "bitboard.h"
+#include "bitboard_othellier.h"
+#include "enum_game.h"
+#include "evaluation.h"
+#include "game_record.h"
+#include "opening_book.h"
+#include "othellier.h"
+#include "player.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_NUMBER_OF_GAMES     100
+#define DEFAULT_OPENING_PLIES       8       // Random moves played before the engines : two bots which don't choose at random would always play the same game
+#define DEFAULT_ENGINE              "ai:100:6:14"
+#define DEFAULT_OUTPUT_FILE         "selfplay.txt"
+#define TEXT_EXTENSION              ".txt"  // Any other output file is a binary archive (game_record.h)
+#define SELFPLAY_HASH_SIZE_MB       8       // Per bot, every worker has its own bots
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// "random" or "ai:<time budget ms>[:<max depth>[:<endgame empty slots>]]"
+struct S_Engine_Config
+{
+    std::string     name;
+    bool            random;
+    unsigned int    time_budget_ms;
+    unsigned int    max_depth;
+    unsigned int    endgame_empties;
+    std::string     book_file;          // Empty : no opening book
+    std::string     weights_file;       // Empty : no pattern evaluation
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Class Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Plays any legal move : the weakest possible engine, a reference for the others
+class Random_Player : public Player
+{
+    public:
+        explicit Random_Player(const E_Pawn_Color color, std::shared_ptr<Board_Engine> othellier, const unsigned int seed) : Player(color, othellier), _generator(seed)
+        {
+        } // Random_Player
+
+        std::tuple<bool, E_Game_Command, unsigned int, unsigned int> Try_Place_Pawn(void) noexcept override
+        {
+            std::tuple<bool, E_Game_Command, unsigned int, unsigned int> result{false, E_Game_Command::NO_COMMAND, 0, 0};
+            uint64_t moves{_othellier->Generate_Legal_Moves(_color)};
+
+            if (!moves) { return result; }
+
+            for (unsigned int skipped{static_cast<unsigned int>(_generator() % Bitboard::Count_Bits(moves))}; skipped > 0; --skipped) { moves &= moves - 1; }
+
+            const unsigned int square{Bitboard::First_Square(moves)};
+
+            std::get<2>(result) = square % NUMBER_COLUMNS + 1;
+            std::get<3>(result) = square / NUMBER_COLUMNS + 1;
+            std::get<bool>(result) = _othellier->Place_Pawn(std::get<2>(result), std::get<3>(result), Pawn{ _color });
+
+            return result;
+        } // Try_Place_Pawn
+
+    protected:
+        std::mt19937 _generator;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Utility Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+bool Parse_Engine_Config(const std::string & name, S_Engine_Config & config)
+{
+    config = S_Engine_Config{name, false, DEFAULT_AI_TIME_BUDGET_MS, MAX_SEARCH_DEPTH, ENDGAME_SOLVER_EMPTIES, "", ""};
+
+    if (name == "random")
+    {
+        config.random = true;
+        return true;
+    }
+
+    if (name.compare(0, 3, "ai:") != 0) { return false; }
+
+    // The files come at the end : the opening book after '@', the pattern weights after '+'
+    const std::string values_text{name.substr(0, name.find_first_of("@+"))};
+
+    for (std::size_t option{name.find_first_of("@+")}; option != std::string::npos; option = name.find_first_of("@+", option + 1))
+    {
+        const std::size_t end{name.find_first_of("@+", option + 1)};
+        (name[option] == '@' ? config.book_file : config.weights_file) = name.substr(option + 1, end == std::string::npos ? std::string::npos : end - option - 1);
+    }
+
+    // Values separated by ':' after "ai:", the ones not given keep their default
+    std::array<unsigned int *, 3> values{{&config.time_budget_ms, &config.max_depth, &config.endgame_empties}};
+    std::size_t position{3};
+
+    for (unsigned int * value : values)
+    {
+        if (position >= values_text.size()) { break; }
+
+        const std::size_t end{values_text.find(':', position)};
+        *value = static_cast<unsigned int>(std::atoi(values_text.substr(position, end - position).c_str()));
+        position = end == std::string::npos ? values_text.size() : end + 1;
+    }
+
+    return config.time_budget_ms > 0 && config.max_depth > 0;
+} // Parse_Engine_Config
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Column letter and row number, as the tournaments write them ("--" for a pass)
+void Write_Game_Record(std::ostream & output, const unsigned int game, const S_Game_Record & record)
+{
+    output << game << ' ' << record.player_1 << ' ' << static_cast<int>(record.result) << ' ' << record.pawns.first << ' ' << record.pawns.second << ' ';
+
+    for (const uint8_t move : record.moves)
+    {
+        if (move == PASS_MOVE)  { output << "--"; }
+        else                    { output << static_cast<char>('a' + move % NUMBER_COLUMNS) << static_cast<char>('1' + move / NUMBER_COLUMNS); }
+    }
+
+    output << '\n';
+} // Write_Game_Record
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Same rules as the game loop of main.cpp, without any display : the game ends when the othellier is full or when both colors pass
+// The game pairs (0, 1), (2, 3)... start from the same random opening, each engine playing it once with each color
+// The players of the record are the engines (1 or 2)
+S_Game_Record Play_Game(const unsigned int game, const unsigned int opening_plies, const unsigned int seed, std::shared_ptr<Bitboard_Othellier> othellier,
+                        std::array<std::array<std::unique_ptr<Player>, 2>, 2> & players) noexcept
+{
+    const unsigned int black_engine{game % 2};
+    S_Game_Record record{0, static_cast<uint16_t>(black_engine + 1), static_cast<uint16_t>(2 - black_engine), E_Game_Result::NO_RESULT, {0, 0}, {}};
+    std::seed_seq opening_seed{seed, game / 2};
+    std::mt19937 generator{opening_seed};
+    E_Pawn_Color color{E_Pawn_Color::BLACK};
+    bool opponent_passed{false};
+
+    othellier->Reset_Othellier();
+    for (auto & engine_players : players)
+    {
+        for (auto & player : engine_players)
+        {
+            if (AI_Player * ai_player = dynamic_cast<AI_Player *>(player.get())) { ai_player->New_Game(); }
+        }
+    }
+
+    while (othellier->Get_Number_of_Free_Slots() > 0)
+    {
+        uint64_t moves{othellier->Generate_Legal_Moves(color)};
+        unsigned int square{PASS_MOVE};
+
+        if (!moves)
+        {
+            if (opponent_passed) { break; }
+        }
+        else if (record.moves.size() < opening_plies)
+        {
+            for (unsigned int skipped{static_cast<unsigned int>(generator() % Bitboard::Count_Bits(moves))}; skipped > 0; --skipped) { moves &= moves - 1; }
+
+            square = Bitboard::First_Square(moves);
+            othellier->Make_Move(square, color);
+        }
+        else
+        {
+            const unsigned int engine{color == E_Pawn_Color::BLACK ? black_engine : 1 - black_engine};
+            const auto player_result = players[engine][color == E_Pawn_Color::BLACK ? 0 : 1]->Try_Place_Pawn();
+
+            // An engine which can play but doesn't is a broken engine : the game is given to its opponent
+            if (!std::get<bool>(player_result))
+            {
+                record.result = color == E_Pawn_Color::BLACK ? E_Game_Result::PLAYER_1_QUIT : E_Game_Result::PLAYER_2_QUIT;
+                break;
+            }
+
+            square = Bitboard::Square_of(std::get<2>(player_result), std::get<3>(player_result));
+        }
+
+        record.moves.push_back(static_cast<uint8_t>(square));
+        opponent_passed = square == PASS_MOVE;
+        color = Get_Opponent_Color(color);
+    }
+
+    // The last two passes are not moves
+    if (opponent_passed && !record.moves.empty()) { record.moves.pop_back(); }
+
+    record.timestamp = static_cast<uint64_t>(std::time(nullptr));
+    record.pawns = othellier->Count_All_Pawns();
+
+    if (record.result == E_Game_Result::NO_RESULT)
+    {
+        if      (record.pawns.first > record.pawns.second)  { record.result = E_Game_Result::PLAYER_1_WIN; }
+        else if (record.pawns.first < record.pawns.second)  { record.result = E_Game_Result::PLAYER_2_WIN; }
+        else                                                { record.result = E_Game_Result::DRAW; }
+    }
+
+    return record;
+} // Play_Game
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : othello-selfplay [games] [workers] [engine 1] [engine 2] [output file] [opening plies] [seed]
+// Plays the games between both engines on a pool of workers (one game per worker at a time, one search thread per bot), without any terminal I/O
+// Each game is written in the output file when it ends, one line per game (see Write_Game_Record) or one record of a binary archive, and the score of the match is displayed at the end
+int main(int argc, char * argv[])
+{
+    const unsigned int number_of_games{argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : DEFAULT_NUMBER_OF_GAMES};
+    const unsigned int hardware_threads{std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1};
+    const unsigned int number_of_workers{argc > 2 && std::atoi(argv[2]) > 0 ? static_cast<unsigned int>(std::atoi(argv[2])) : hardware_threads};
+    const std::string output_file{argc > 5 ? argv[5] : DEFAULT_OUTPUT_FILE};
+    const unsigned int opening_plies{argc > 6 ? static_cast<unsigned int>(std::atoi(argv[6])) : DEFAULT_OPENING_PLIES};
+    const unsigned int seed{argc > 7 ? static_cast<unsigned int>(std::atoi(argv[7])) : 0};
+
+    std::array<S_Engine_Config, 2> engines;
+
+    for (unsigned int engine{0}; engine < 2; ++engine)
+    {
+        const std::string name{argc > 3 + static_cast<int>(engine) ? argv[3 + engine] : DEFAULT_ENGINE};
+
+        if (!Parse_Engine_Config(name, engines[engine]))
+        {
+            std::cerr << "Unknown engine " << name << " : random or ai:<time budget ms>[:<max depth>[:<endgame empty slots>]][@<opening book>]" << std::endl;
+            return 1;
+        }
+    }
+
+    // A book or weights file is read once, and used by the bots of every worker
+    std::array<std::shared_ptr<Opening_Book>, 2> opening_books;
+    std::array<std::shared_ptr<Pattern_Weights>, 2> evaluation_weights;
+
+    for (unsigned int engine{0}; engine < 2; ++engine)
+    {
+        if (!engines[engine].book_file.empty())
+        {
+            opening_books[engine] = std::make_shared<Opening_Book>();
+
+            if (!opening_books[engine]->Open(engines[engine].book_file))
+            {
+                std::cerr << "Can't read the opening book " << engines[engine].book_file << std::endl;
+                return 1;
+            }
+        }
+
+        if (!engines[engine].weights_file.empty())
+        {
+            evaluation_weights[engine] = std::make_shared<Pattern_Weights>();
+
+            if (!evaluation_weights[engine]->Load(engines[engine].weights_file))
+            {
+                std::cerr << "Can't read the pattern weights " << engines[engine].weights_file << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    const std::string text_extension{TEXT_EXTENSION};
+    const bool text_output{output_file.size() >= text_extension.size() && output_file.compare(output_file.size() - text_extension.size(), text_extension.size(), text_extension) == 0};
+    std::ofstream output;
+    Game_Record_Writer archive;
+
+    if (text_output)    { output.open(output_file); }
+    else                { archive.Open(output_file); }
+
+    if ((text_output && !output) || (!text_output && !archive.Flush()))
+    {
+        std::cerr << "Can't write " << output_file << std::endl;
+        return 1;
+    }
+
+    if (text_output)
+    {
+        output << "# engine 1 " << engines[0].name << "\n# engine 2 " << engines[1].name << "\n# opening plies " << opening_plies << ", seed " << seed << '\n';
+        output << "# game, engine playing black, result (E_Game_Result), black pawns, white pawns, moves\n";
+    }
+
+    bool written{true};
+
+    std::atomic<unsigned int> next_game{0};
+    std::mutex output_mutex;
+    std::array<unsigned int, 3> score{{0, 0, 0}};   // Wins of the engine 1, wins of the engine 2, draws
+    std::vector<std::thread> workers;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int worker{0}; worker < number_of_workers; ++worker)
+    {
+        workers.emplace_back([&, worker]()
+        {
+            // Every worker has its own othellier and bots, created once : [engine][color]
+            std::shared_ptr<Bitboard_Othellier> othellier{std::make_shared<Bitboard_Othellier>()};
+            std::array<std::array<std::unique_ptr<Player>, 2>, 2> players;
+
+            for (unsigned int engine{0}; engine < 2; ++engine)
+            {
+                for (const E_Pawn_Color color : {E_Pawn_Color::BLACK, E_Pawn_Color::WHITE})
+                {
+                    std::unique_ptr<Player> & player = players[engine][color == E_Pawn_Color::BLACK ? 0 : 1];
+
+                    if (engines[engine].random)
+                    {
+                        player = std::make_unique<Random_Player>(color, othellier, seed + worker * 4 + engine * 2 + (color == E_Pawn_Color::BLACK ? 0 : 1));
+                    }
+                    else
+                    {
+                        std::unique_ptr<AI_Player> ai_player{std::make_unique<AI_Player>(color, othellier, engines[engine].time_budget_ms, 1, SELFPLAY_HASH_SIZE_MB, false)};
+
+                        ai_player->Set_Max_Depth(engines[engine].max_depth);
+                        ai_player->Set_Endgame_Empties(engines[engine].endgame_empties);
+                        ai_player->Set_Opening_Book(opening_books[engine]);
+                        ai_player->Set_Evaluation_Weights(evaluation_weights[engine]);
+                        player = std::move(ai_player);
+                    }
+                }
+            }
+
+            for (unsigned int game{next_game++}; game < number_of_games; game = next_game++)
+            {
+                const S_Game_Record record{Play_Game(game, opening_plies, seed, othellier, players)};
+                const bool black_wins{record.result == E_Game_Result::PLAYER_1_WIN || record.result == E_Game_Result::PLAYER_2_QUIT};
+                const bool white_wins{record.result == E_Game_Result::PLAYER_2_WIN || record.result == E_Game_Result::PLAYER_1_QUIT};
+
+                std::lock_guard<std::mutex> lock(output_mutex);
+
+                if (text_output)    { Write_Game_Record(output, game, record); }
+                else                { written = archive.Write_Game(record) && written; }
+
+                if      (black_wins) { ++score[record.player_1 - 1]; }
+                else if (white_wins) { ++score[record.player_2 - 1]; }
+                else                 { ++score[2]; }
+            }
+        });
+    }
+
+    for (std::thread & worker : workers) { worker.join(); }
+
+    const double elapsed_s{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+    std::cout << number_of_games << " games (" << engines[0].name << " vs " << engines[1].name << ") with " << number_of_workers << " workers in " << elapsed_s << " s : "
+              << number_of_games / (elapsed_s + 1e-9) << " games/s" << std::endl;
+    std::cout << "engine 1 wins " << score[0] << ", engine 2 wins " << score[1] << ", draws " << score[2] << ", games written in " << output_file << std::endl;
+
+    if (!text_output) { written = archive.Flush() && written; }
+
+    return written && (!text_output || output) ? 0 : 1;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
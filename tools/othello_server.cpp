@@ -0,0 +1,90 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "game_server.h"
+
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <unistd.h>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_REPORT_INTERVAL_S   5
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Utility Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static Game_Server * running_server{nullptr};
+
+extern "C" void Stop_Server(int)
+{
+    if (running_server) { running_server->Stop(); }
+} // Stop_Server
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : othello_server <tcp:[host:]port | unix:path> [workers] [report interval s] [duration s]
+// Serves games to many clients at once (see README, Game server) until SIGINT or SIGTERM, or for the duration when one is given
+// Workers : threads searching the bot moves, one per core by default - the statistics are written every report interval, and once more at the end
+int main(int argc, char * argv[])
+{
+    S_Server_Address address;
+
+    if (argc < 2 || !Parse_Server_Address(argv[1], true, address))
+    {
+        std::cerr << "Usage : othello_server <tcp:[host:]port | unix:path> [workers] [report interval s] [duration s]" << std::endl;
+        return 1;
+    }
+
+    const unsigned int number_of_workers{argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : DEFAULT_SERVER_WORKERS};
+    const unsigned int report_interval_s{argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : DEFAULT_REPORT_INTERVAL_S};
+    const unsigned int duration_s{argc > 4 ? static_cast<unsigned int>(std::atoi(argv[4])) : 0};
+
+    Game_Server server{number_of_workers};
+
+    if (!server.Listen(address))
+    {
+        std::cerr << "Can't listen on " << argv[1] << std::endl;
+        return 1;
+    }
+
+    running_server = &server;
+    std::signal(SIGINT, Stop_Server);
+    std::signal(SIGTERM, Stop_Server);
+
+    // The duration is an alarm calling Stop, as the signals do
+    if (duration_s > 0)
+    {
+        std::signal(SIGALRM, Stop_Server);
+        ::alarm(duration_s);
+    }
+
+    std::cout << "listening on " << argv[1] << std::endl;
+    server.Run(report_interval_s);
+
+    const S_Server_Statistics statistics{server.Get_Statistics()};
+
+    std::cout << "served " << statistics.matches << " matches in " << statistics.elapsed_s << " s (" << statistics.matches_per_second << " matches/s), "
+              << statistics.moves << " moves and " << statistics.bot_moves << " bot moves, move validation p50 " << statistics.validation_p50_ns / 1000.0
+              << " us p99 " << statistics.validation_p99_ns / 1000.0 << " us" << std::endl;
+
+    running_server = nullptr;
+
+    return 0;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,229 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_othellier.h"
+#include "evaluation.h"
+#include "game_record.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_EPOCHS          20
+#define DEFAULT_LEARNING_RATE   1.0
+#define MIN_WEIGHT_COUNT        8       // A weight seen in few positions moves less : its average error is not reliable
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// What a thread accumulates over its part of the archive during one epoch
+struct S_Training_Thread
+{
+    std::vector<float>      errors;         // Sum of the errors of the positions where each weight is used
+    std::vector<uint32_t>   counts;         // Number of these positions
+    unsigned long long      positions;
+    double                  squared_error;
+    unsigned long long      wrong_games;    // Games with an illegal move, skipped
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Utility Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Replays the games [first game, last game) with the same incremental indices as the search : every position before a move is a sample
+// The target is the final difference of pawns for black (Count_All_Pawns, so the empty slots go to the winner), the prediction the weights in pawns
+void Train_Games(const Game_Record_Reader & reader, const std::size_t first_game, const std::size_t last_game, const std::vector<float> & weights, S_Training_Thread & thread)
+{
+    Bitboard_Othellier othellier;
+    Pattern_Evaluator evaluator;
+
+    std::fill(thread.errors.begin(), thread.errors.end(), 0.0f);
+    std::fill(thread.counts.begin(), thread.counts.end(), 0);
+    thread.positions = 0;
+    thread.squared_error = 0;
+    thread.wrong_games = 0;
+
+    for (std::size_t game_number{first_game}; game_number < last_game; ++game_number)
+    {
+        const S_Game_Record_View game{reader.Get_Game(game_number)};
+        const float target{static_cast<float>(static_cast<int>(game.pawns.first) - static_cast<int>(game.pawns.second))};
+        E_Pawn_Color color{E_Pawn_Color::BLACK};
+
+        othellier.Reset_Othellier();
+        evaluator.Set_Position(othellier.Get_Pawns(E_Pawn_Color::BLACK), othellier.Get_Pawns(E_Pawn_Color::WHITE));
+
+        for (unsigned int index{0}; index < game.number_of_moves; ++index)
+        {
+            const unsigned int move{game.moves[index]};
+
+            if (move != PASS_MOVE)
+            {
+                if (move >= NUMBER_SQUARES || !(othellier.Generate_Legal_Moves(color) & Bitboard::Square_Bit(move)))
+                {
+                    ++thread.wrong_games;
+                    break;
+                }
+
+                const unsigned int phase{Get_Pattern_Phase(NUMBER_SQUARES - othellier.Get_Number_of_Free_Slots())};
+                const uint16_t * indices{evaluator.Get_Indices()};
+                float prediction{0};
+
+                for (unsigned int feature{0}; feature < NUMBER_PATTERN_FEATURES; ++feature) { prediction += weights[Get_Weight_Offset(phase, feature) + indices[feature]]; }
+
+                const float error{target - prediction};
+
+                for (unsigned int feature{0}; feature < NUMBER_PATTERN_FEATURES; ++feature)
+                {
+                    const std::size_t weight{Get_Weight_Offset(phase, feature) + indices[feature]};
+
+                    thread.errors[weight] += error;
+                    ++thread.counts[weight];
+                }
+
+                ++thread.positions;
+                thread.squared_error += static_cast<double>(error) * error;
+
+                const S_Move_Undo & undo = othellier.Make_Move(move, color);
+                evaluator.Make_Move(move, undo.flips, color);
+            }
+
+            color = Get_Opponent_Color(color);
+        }
+    }
+} // Train_Games
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : pattern_trainer <archive> [output file] [epochs] [threads] [learning rate]
+// Fits the pattern weights to the final results of the games of the archive, by gradient descent on the squared error, and writes the weights file
+// The archive is mapped, never loaded : each epoch reads it again, split between the threads, so its size is only limited by the disk
+// The training starts from the weights of the output file when it can be loaded, to go on with more games or more epochs
+int main(int argc, char * argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage : pattern_trainer <archive> [output file] [epochs] [threads] [learning rate]" << std::endl;
+        return 1;
+    }
+
+    const std::string output_file{argc > 2 ? argv[2] : DEFAULT_WEIGHTS_FILE};
+    const unsigned int epochs{argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : DEFAULT_EPOCHS};
+    const unsigned int hardware_threads{std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1};
+    const unsigned int number_of_threads{argc > 4 && std::atoi(argv[4]) > 0 ? static_cast<unsigned int>(std::atoi(argv[4])) : hardware_threads};
+    const float learning_rate{argc > 5 ? static_cast<float>(std::atof(argv[5])) : static_cast<float>(DEFAULT_LEARNING_RATE)};
+
+    Game_Record_Reader reader;
+
+    if (!reader.Open(argv[1]))
+    {
+        std::cerr << "Can't read the archive " << argv[1] << std::endl;
+        return 1;
+    }
+
+    // The weights are fitted in pawns, and only rounded to the weights file at the end
+    Pattern_Weights pattern_weights;
+    std::vector<float> weights(pattern_weights.Get_Size(), 0.0f);
+
+    if (pattern_weights.Load(output_file))
+    {
+        for (std::size_t weight{0}; weight < weights.size(); ++weight) { weights[weight] = static_cast<float>(pattern_weights.Get_Data()[weight]) / PATTERN_WEIGHT_SCALE; }
+        std::cout << "training from the weights of " << output_file << std::endl;
+    }
+
+    std::vector<S_Training_Thread> threads(number_of_threads);
+
+    for (S_Training_Thread & thread : threads)
+    {
+        thread.errors.resize(weights.size());
+        thread.counts.resize(weights.size());
+    }
+
+    const std::size_t number_of_games{reader.Get_Number_of_Games()};
+
+    std::cout << number_of_games << " games, " << number_of_threads << " threads, " << weights.size() << " weights" << std::endl;
+
+    for (unsigned int epoch{1}; epoch <= epochs; ++epoch)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+
+        for (unsigned int thread{0}; thread < number_of_threads; ++thread)
+        {
+            workers.emplace_back(Train_Games, std::cref(reader), number_of_games * thread / number_of_threads, number_of_games * (thread + 1) / number_of_threads,
+                                 std::cref(weights), std::ref(threads[thread]));
+        }
+
+        for (std::thread & worker : workers) { worker.join(); }
+
+        unsigned long long positions{0};
+        unsigned long long wrong_games{0};
+        double squared_error{0};
+
+        for (const S_Training_Thread & thread : threads)
+        {
+            positions += thread.positions;
+            wrong_games += thread.wrong_games;
+            squared_error += thread.squared_error;
+        }
+
+        // Each weight moves by the average error of its positions, shared between the features which made the prediction
+        for (std::size_t weight{0}; weight < weights.size(); ++weight)
+        {
+            float error{0};
+            uint32_t count{0};
+
+            for (const S_Training_Thread & thread : threads)
+            {
+                error += thread.errors[weight];
+                count += thread.counts[weight];
+            }
+
+            if (count > 0) { weights[weight] += learning_rate * error / (static_cast<float>(count + MIN_WEIGHT_COUNT) * NUMBER_PATTERN_FEATURES); }
+        }
+
+        const double elapsed_s{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+        std::cout << "epoch " << epoch << " : " << positions << " positions, error " << std::sqrt(squared_error / (positions ? positions : 1)) << " pawns, "
+                  << static_cast<unsigned long long>(positions / (elapsed_s + 1e-9)) << " positions/s" << (wrong_games ? ", games with illegal moves skipped " : "")
+                  << (wrong_games ? std::to_string(wrong_games) : "") << std::endl;
+    }
+
+    for (std::size_t weight{0}; weight < weights.size(); ++weight)
+    {
+        const float value{std::round(weights[weight] * PATTERN_WEIGHT_SCALE)};
+        pattern_weights.Get_Data()[weight] = static_cast<int16_t>(std::max(-32767.0f, std::min(32767.0f, value)));
+    }
+
+    if (!pattern_weights.Save(output_file))
+    {
+        std::cerr << "Can't write " << output_file << std::endl;
+        return 1;
+    }
+
+    std::cout << "weights written in " << output_file << std::endl;
+
+    return 0;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
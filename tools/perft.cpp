@@ -0,0 +1,169 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_kernels.h"
+#include "bitboard_othellier.h"
+#include "othellier.h"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <initializer_list>
+#include <iostream>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_PERFT_DEPTH     9
+#define MAX_KNOWN_PERFT_DEPTH   11
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Static Variables */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Published number of leaves from the starting position, a pass being one ply (index = depth)
+static const std::array<unsigned long long, MAX_KNOWN_PERFT_DEPTH + 1> known_perft_counts
+{{
+    1ULL, 4ULL, 12ULL, 56ULL, 244ULL, 1396ULL, 8200ULL, 55092ULL, 390216ULL, 3005288ULL, 24571284ULL, 212258800ULL
+}};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Perft Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Leaves under the position : a color without move passes (one ply), a game over before the depth is one leaf
+unsigned long long Perft(Bitboard_Othellier & othellier, const E_Pawn_Color color, const unsigned int depth, const bool opponent_passed) noexcept
+{
+    if (depth == 0) { return 1; }
+
+    uint64_t moves{othellier.Generate_Legal_Moves(color)};
+
+    if (!moves)
+    {
+        if (opponent_passed) { return 1; }
+        return Perft(othellier, Get_Opponent_Color(color), depth - 1, true);
+    }
+
+    // Last ply : the moves are the leaves, they don't need to be played
+    if (depth == 1) { return Bitboard::Count_Bits(moves); }
+
+    unsigned long long leaves{0};
+
+    for (; moves; moves &= moves - 1)
+    {
+        othellier.Make_Move(Bitboard::First_Square(moves), color);
+        leaves += Perft(othellier, Get_Opponent_Color(color), depth - 1, false);
+        othellier.Unmake_Move();
+    }
+
+    return leaves;
+} // Perft
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+// Same count with the slots othellier : it has no undo, every move is played on a copy through Place_Pawn
+unsigned long long Perft(const Othellier & othellier, const E_Pawn_Color color, const unsigned int depth, const bool opponent_passed) noexcept
+{
+    if (depth == 0) { return 1; }
+
+    uint64_t moves{othellier.Generate_Legal_Moves(color)};
+
+    if (!moves)
+    {
+        if (opponent_passed) { return 1; }
+        return Perft(othellier, Get_Opponent_Color(color), depth - 1, true);
+    }
+
+    if (depth == 1) { return Bitboard::Count_Bits(moves); }
+
+    unsigned long long leaves{0};
+
+    for (; moves; moves &= moves - 1)
+    {
+        const unsigned int square{Bitboard::First_Square(moves)};
+        Othellier next_othellier{othellier};
+
+        next_othellier.Place_Pawn(square % NUMBER_COLUMNS + 1, square / NUMBER_COLUMNS + 1, Pawn{ color });
+        leaves += Perft(next_othellier, Get_Opponent_Color(color), depth - 1, false);
+    }
+
+    return leaves;
+} // Perft
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : perft [depth] [bitboard | slots] [scalar | avx2 | avx512]
+// Counts the leaves of every depth from 1 to depth with the chosen engine, checks them against the published counts and reports the nodes per second
+// The kernels are the fastest ones of the processor, unless one is asked
+int main(int argc, char * argv[])
+{
+    const unsigned int depth{argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : DEFAULT_PERFT_DEPTH};
+    const bool use_slots{argc > 2 && std::strcmp(argv[2], "slots") == 0};
+
+    if (argc > 3)
+    {
+        bool selected{false};
+
+        for (const E_Kernel_Type type : {E_Kernel_Type::SCALAR, E_Kernel_Type::AVX2, E_Kernel_Type::AVX512})
+        {
+            if (std::strcmp(argv[3], Bitboard::Get_Kernel_Name(type)) == 0) { selected = Bitboard::Select_Kernels(type); }
+        }
+
+        if (!selected)
+        {
+            std::cout << "Kernels " << argv[3] << " not supported by this processor" << std::endl;
+            return 1;
+        }
+    }
+
+    Bitboard_Othellier bitboard_othellier;
+    Othellier othellier;
+    bool all_exact{true};
+
+    std::cout << "Perft from the starting position, " << (use_slots ? "Othellier (slots)" : "Bitboard_Othellier")
+              << ", " << Bitboard::Get_Kernel_Name(Bitboard::kernels.type) << " kernels" << std::endl;
+    std::cout << "depth           leaves        expected   time (ms)        leaves/s" << std::endl;
+
+    for (unsigned int current_depth{1}; current_depth <= depth; ++current_depth)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        const unsigned long long leaves{use_slots ? Perft(othellier, E_Pawn_Color::BLACK, current_depth, false)
+                                                  : Perft(bitboard_othellier, E_Pawn_Color::BLACK, current_depth, false)};
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const bool known{current_depth <= MAX_KNOWN_PERFT_DEPTH};
+        const bool exact{!known || leaves == known_perft_counts[current_depth]};
+
+        all_exact = all_exact && exact;
+
+        std::cout << std::setw(5)  << current_depth
+                  << std::setw(17) << leaves
+                  << std::setw(16);
+
+        if (known)  { std::cout << known_perft_counts[current_depth]; }
+        else        { std::cout << "-"; }
+
+        std::cout << std::setw(12) << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()
+                  << std::setw(16) << static_cast<unsigned long long>(leaves / (std::chrono::duration<double>(elapsed).count() + 1e-9))
+                  << (exact ? "" : "   WRONG COUNT") << std::endl;
+    }
+
+    return all_exact ? 0 : 1;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,169 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_othellier.h"
+#include "renderer.h"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_NUMBER_OF_GAMES     1000
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Utility Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Plays the bytes written by the renderer on a screen of characters, with the only sequences it sends (cursor move, clear, clear under the cursor)
+void Play_Terminal_Output(const std::string & output, std::vector<std::string> & screen, unsigned int & row, unsigned int & column)
+{
+    for (std::size_t index{0}; index < output.size(); ++index)
+    {
+        if (output[index] != '\x1b')
+        {
+            if (row < screen.size() && column < screen[row].size()) { screen[row][column] = output[index]; }
+            ++column;
+            continue;
+        }
+
+        // ESC [ parameters final
+        unsigned int parameters[2]{0, 0};
+        unsigned int number_of_parameters{0};
+
+        for (index += 2; output[index] >= '0' && output[index] <= ';'; ++index)
+        {
+            if (output[index] == ';')   { ++number_of_parameters; }
+            else                        { parameters[number_of_parameters] = parameters[number_of_parameters] * 10 + (output[index] - '0'); }
+        }
+
+        switch (output[index])
+        {
+            case 'H':   row = parameters[0] > 0 ? parameters[0] - 1 : 0; column = parameters[1] > 0 ? parameters[1] - 1 : 0; break;
+            case 'J':
+                for (unsigned int line{parameters[0] == 2 ? 0 : row}; line < screen.size(); ++line) { screen[line].assign(screen[line].size(), ' '); }
+                break;
+            default:    break;
+        }
+    }
+} // Play_Terminal_Output
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : render_bench [number of games]
+// Draws every position of random games with Terminal_Renderer, checks that the bytes sent rebuild each frame on a screen, and reports the bytes per frame
+// against a whole frame each time (the clear and redraw of the game loop before the renderer) and the frames per second
+int main(int argc, char * argv[])
+{
+    const unsigned int number_of_games{argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : DEFAULT_NUMBER_OF_GAMES};
+
+    std::FILE * output_file{std::tmpfile()};
+
+    if (output_file == nullptr)
+    {
+        std::cerr << "Can't create a temporary file" << std::endl;
+        return 1;
+    }
+
+    Terminal_Renderer renderer{DEFAULT_FRAME_ROWS, DEFAULT_FRAME_COLUMNS, output_file};
+    Terminal_Renderer full_renderer{DEFAULT_FRAME_ROWS, DEFAULT_FRAME_COLUMNS, output_file};
+    std::vector<std::string> screen(DEFAULT_FRAME_ROWS + 1, std::string(DEFAULT_FRAME_COLUMNS, ' '));
+    std::string output;
+    unsigned int cursor_row{0};
+    unsigned int cursor_column{0};
+
+    std::mt19937 generator{2017};
+    Bitboard_Othellier othellier;
+    unsigned long long frames{0};
+    unsigned long long bytes{0};
+    unsigned long long full_bytes{0};
+    unsigned long long wrong_frames{0};
+    double elapsed_s{0};
+
+    for (unsigned int game{0}; game < number_of_games; ++game)
+    {
+        E_Pawn_Color color{E_Pawn_Color::BLACK};
+        unsigned int passes{0};
+
+        othellier.Reset_Othellier();
+
+        while (passes < 2)
+        {
+            // The frame of the game loop, timed alone
+            std::rewind(output_file);
+
+            const auto start = std::chrono::steady_clock::now();
+            renderer.Clear_Frame();
+            renderer.Draw_Othellier(othellier);
+            const std::size_t size{renderer.Present()};
+            elapsed_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            ++frames;
+            bytes += size;
+
+            // The screen rebuilt from the bytes must be the frame
+            output.resize(size);
+            std::rewind(output_file);
+            if (std::fread(&output[0], 1, size, output_file) != size) { ++wrong_frames; }
+            Play_Terminal_Output(output, screen, cursor_row, cursor_column);
+
+            std::array<std::array<char, OTHELLIER_TEXT_COLUMNS + 1>, OTHELLIER_TEXT_ROWS> text;
+            Format_Othellier(othellier.Get_Pawns(E_Pawn_Color::BLACK), othellier.Get_Pawns(E_Pawn_Color::WHITE), text);
+
+            for (unsigned int line{0}; line < OTHELLIER_TEXT_ROWS; ++line)
+            {
+                std::string expected{text[line].data()};
+                expected.resize(DEFAULT_FRAME_COLUMNS, ' ');
+
+                if (screen[line] != expected) { ++wrong_frames; break; }
+            }
+
+            // The same frame sent whole
+            std::rewind(output_file);
+            full_renderer.Invalidate();
+            full_renderer.Clear_Frame();
+            full_renderer.Draw_Othellier(othellier);
+            full_bytes += full_renderer.Present();
+
+            uint64_t moves{othellier.Generate_Legal_Moves(color)};
+
+            if (moves)
+            {
+                for (unsigned int skip{static_cast<unsigned int>(generator() % Bitboard::Count_Bits(moves))}; skip > 0; --skip) { moves &= moves - 1; }
+                othellier.Make_Move(Bitboard::First_Square(moves), color);
+                passes = 0;
+            }
+            else { ++passes; }
+
+            color = Get_Opponent_Color(color);
+        }
+    }
+
+    std::fclose(output_file);
+
+    std::cout << "Render bench : " << number_of_games << " games, " << frames << " frames" << std::endl;
+    std::cout << "bytes per frame : " << bytes / (frames ? frames : 1) << " (whole frame : " << full_bytes / (frames ? frames : 1) << ")" << std::endl;
+    std::cout << "frames/s : " << static_cast<unsigned long long>(frames / (elapsed_s + 1e-9)) << std::endl;
+    std::cout << (wrong_frames ? "WRONG FRAMES : " + std::to_string(wrong_frames) : std::string("every frame checked")) << std::endl;
+
+    return wrong_frames ? 1 : 0;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
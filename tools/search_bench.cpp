@@ -0,0 +1,113 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_kernels.h"
+#include "bitboard_othellier.h"
+#include "search.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define NUMBER_OF_POSITIONS     20
+#define PLIES_BEFORE_SEARCH     20      // Positions are taken in the middle game, where the search is the most expensive
+#define DEFAULT_BENCH_DEPTH     9
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Utility Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Always the same positions : random games with a fixed seed (std::mt19937 gives the same sequence on every platform)
+std::vector< std::pair<Bitboard_Othellier, E_Pawn_Color> > Create_Bench_Positions(void)
+{
+    std::vector< std::pair<Bitboard_Othellier, E_Pawn_Color> > positions;
+    std::mt19937 generator{2017};
+
+    while (positions.size() < NUMBER_OF_POSITIONS)
+    {
+        Bitboard_Othellier othellier;
+        E_Pawn_Color color{E_Pawn_Color::BLACK};
+
+        for (unsigned int ply{0}; ply < PLIES_BEFORE_SEARCH; ++ply)
+        {
+            uint64_t moves{othellier.Generate_Legal_Moves(color)};
+
+            if (moves)
+            {
+                for (unsigned int skip{static_cast<unsigned int>(generator() % Bitboard::Count_Bits(moves))}; skip > 0; --skip) { moves &= moves - 1; }
+                othellier.Make_Move(Bitboard::First_Square(moves), color);
+            }
+
+            color = Get_Opponent_Color(color);
+        }
+
+        if (othellier.Generate_Legal_Moves(color)) { positions.emplace_back(othellier, color); }
+    }
+
+    return positions;
+} // Create_Bench_Positions
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : search_bench [depth] [max threads]
+// Searches the same positions to a fixed depth with 1, 2, 4... threads and reports the speedup of each thread count
+int main(int argc, char * argv[])
+{
+    const unsigned int depth      {argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : DEFAULT_BENCH_DEPTH};
+    const unsigned int max_threads{argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : std::max(1U, std::thread::hardware_concurrency())};
+
+    const auto positions = Create_Bench_Positions();
+    double reference_ms{0.0};
+
+    std::cout << "Search bench : " << positions.size() << " positions, depth " << depth << ", " << Bitboard::Get_Kernel_Name(Bitboard::kernels.type) << " kernels" << std::endl;
+    std::cout << "threads        time (ms)        nodes       nodes/s   speedup" << std::endl;
+
+    for (unsigned int number_of_threads{1}; ; number_of_threads *= 2)
+    {
+        if (number_of_threads > max_threads) { number_of_threads = max_threads; }
+
+        Search_Engine search_engine{number_of_threads};
+        unsigned long long nodes{0};
+        unsigned long long elapsed_ms{0};
+
+        for (const auto & position : positions)
+        {
+            // Each position starts from an empty hash table, whatever the thread count
+            search_engine.Clear_Hash();
+            const S_Search_Result result{search_engine.Search(position.first, position.second, NO_TIME_LIMIT_MS, depth)};
+            nodes += result.nodes;
+            elapsed_ms += result.elapsed_ms;
+        }
+
+        if (number_of_threads == 1) { reference_ms = static_cast<double>(elapsed_ms); }
+
+        std::cout << std::setw(7)  << number_of_threads
+                  << std::setw(17) << elapsed_ms
+                  << std::setw(13) << nodes
+                  << std::setw(14) << static_cast<unsigned long long>(nodes * 1000.0 / (elapsed_ms + 1))
+                  << std::setw(10) << std::fixed << std::setprecision(2) << reference_ms / (elapsed_ms + 1e-9) << std::endl;
+
+        if (number_of_threads == max_threads) { break; }
+    }
+
+    return 0;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
@@ -0,0 +1,301 @@
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Includes */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#include "bitboard.h"
+#include "bitboard_othellier.h"
+#include "game_server.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Defines */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_CONNECTIONS     100
+#define DEFAULT_MATCHES         10      // Played one after the other by each connection
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Structure Definition */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// A stand-in player : it keeps its own othellier, to play legal moves and check every move and result of the server
+struct S_Client_Connection
+{
+    int                 descriptor;
+    std::string         input;
+    Bitboard_Othellier  othellier;
+    E_Pawn_Color        color;              // Color to play
+    unsigned int        matches_left;
+    bool                waiting_move;       // A MOVE was sent, its PLAYED not received yet
+    std::chrono::steady_clock::time_point move_sent;
+    bool                done;
+};
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Utility Functions */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static bool Send_Line(const int descriptor, const std::string & line)
+{
+    std::size_t written{0};
+
+    while (written < line.size())
+    {
+        const ssize_t count{::send(descriptor, line.data() + written, line.size() - written, MSG_NOSIGNAL)};
+        if (count <= 0) { return false; }
+
+        written += static_cast<std::size_t>(count);
+    }
+
+    return true;
+} // Send_Line
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+
+static E_Pawn_Color Parse_Color(const std::string & text)
+{
+    return text == "B" ? E_Pawn_Color::BLACK : E_Pawn_Color::WHITE;
+} // Parse_Color
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/
+/* Main */
+/*------------------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+// Usage : server_client <tcp:[host:]port | unix:path> [connections] [matches per connection] [humans | bot:<depth> | bots:<depth>]
+// Load generator for othello_server : every connection plays its matches with random legal moves (both colors against humans, black against a bot)
+// Each move of the server is checked against the othellier of the client, and each result against its count of pawns - any difference is an error
+// Writes the matches per second, the round trip of the moves (MOVE sent to PLAYED received), then the statistics of the server
+int main(int argc, char * argv[])
+{
+    S_Server_Address address;
+
+    if (argc < 2 || !Parse_Server_Address(argv[1], false, address))
+    {
+        std::cerr << "Usage : server_client <tcp:[host:]port | unix:path> [connections] [matches per connection] [humans | bot:<depth> | bots:<depth>]" << std::endl;
+        return 1;
+    }
+
+    const unsigned int number_of_connections{argc > 2 && std::atoi(argv[2]) > 0 ? static_cast<unsigned int>(std::atoi(argv[2])) : DEFAULT_CONNECTIONS};
+    const unsigned int number_of_matches{argc > 3 && std::atoi(argv[3]) > 0 ? static_cast<unsigned int>(std::atoi(argv[3])) : DEFAULT_MATCHES};
+    const std::string mode{argc > 4 ? argv[4] : "humans"};
+
+    std::string new_game;
+
+    if      (mode == "humans")                  { new_game = "NEW HUMANS\n"; }
+    else if (mode.compare(0, 4, "bot:") == 0)   { new_game = "NEW BOT " + mode.substr(4) + "\n"; }
+    else if (mode.compare(0, 5, "bots:") == 0)  { new_game = "NEW BOTS " + mode.substr(5) + "\n"; }
+    else
+    {
+        std::cerr << "Unknown mode " << mode << std::endl;
+        return 1;
+    }
+
+    const int epoll_descriptor{::epoll_create1(0)};
+    std::vector<S_Client_Connection> connections(number_of_connections);
+    const auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int index{0}; index < number_of_connections; ++index)
+    {
+        S_Client_Connection & connection = connections[index];
+
+        connection.descriptor = Connect_to_Server(address);
+        connection.color = E_Pawn_Color::BLACK;
+        connection.matches_left = number_of_matches;
+        connection.waiting_move = false;
+        connection.done = false;
+
+        if (connection.descriptor < 0)
+        {
+            std::cerr << "Can't connect to " << argv[1] << std::endl;
+            return 1;
+        }
+
+        struct epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u32 = index;
+
+        ::epoll_ctl(epoll_descriptor, EPOLL_CTL_ADD, connection.descriptor, &event);
+        Send_Line(connection.descriptor, new_game);
+    }
+
+    std::mt19937_64 generator{12345};
+    Latency_Histogram round_trips;
+    unsigned long long matches{0};
+    unsigned long long errors{0};
+    unsigned int connections_left{number_of_connections};
+    std::array<struct epoll_event, SERVER_MAX_EVENTS> events;
+
+    while (connections_left > 0)
+    {
+        const int number_of_events{::epoll_wait(epoll_descriptor, events.data(), SERVER_MAX_EVENTS, -1)};
+
+        for (int event{0}; event < number_of_events; ++event)
+        {
+            S_Client_Connection & connection = connections[events[event].data.u32];
+            if (connection.done) { continue; }
+
+            std::array<char, SERVER_READ_SIZE> buffer;
+            const ssize_t count{::read(connection.descriptor, buffer.data(), buffer.size())};
+
+            if (count <= 0)
+            {
+                std::cerr << "connection closed by the server" << std::endl;
+                ++errors;
+                connection.done = true;
+                --connections_left;
+                continue;
+            }
+
+            connection.input.append(buffer.data(), static_cast<std::size_t>(count));
+            std::string answer;
+            std::size_t line_start{0};
+
+            for (std::size_t line_end{connection.input.find('\n')}; line_end != std::string::npos && !connection.done; line_end = connection.input.find('\n', line_start))
+            {
+                std::istringstream words{connection.input.substr(line_start, line_end - line_start)};
+                std::string command;
+                std::string argument;
+                std::string second_argument;
+
+                words >> command >> argument >> second_argument;
+                line_start = line_end + 1;
+
+                bool valid{true};
+
+                if (command == "GAME")
+                {
+                    connection.othellier.Reset_Othellier();
+                    connection.color = E_Pawn_Color::BLACK;
+                }
+                else if (command == "TURN")
+                {
+                    const uint64_t moves{connection.othellier.Generate_Legal_Moves(connection.color)};
+                    valid = Parse_Color(argument) == connection.color && moves != 0;
+
+                    if (valid)
+                    {
+                        // Random legal move : the n-th bit of the moves
+                        uint64_t remaining{moves};
+                        for (auto skip = generator() % Bitboard::Count_Bits(moves); skip > 0; --skip) { remaining &= remaining - 1; }
+
+                        answer += "MOVE " + Format_Square(Bitboard::First_Square(remaining)) + "\n";
+                        connection.waiting_move = true;
+                        connection.move_sent = std::chrono::steady_clock::now();
+                    }
+                }
+                else if (command == "PLAYED")
+                {
+                    const unsigned int square{Parse_Square(second_argument)};
+
+                    valid = Parse_Color(argument) == connection.color && square < NUMBER_SQUARES
+                         && (connection.othellier.Generate_Legal_Moves(connection.color) & Bitboard::Square_Bit(square));
+
+                    if (valid)
+                    {
+                        if (connection.waiting_move)
+                        {
+                            round_trips.Add(static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - connection.move_sent).count()));
+                            connection.waiting_move = false;
+                        }
+
+                        connection.othellier.Make_Move(square, connection.color);
+                        connection.color = Get_Opponent_Color(connection.color);
+                    }
+                }
+                else if (command == "PASS")
+                {
+                    valid = Parse_Color(argument) == connection.color && !connection.othellier.Generate_Legal_Moves(connection.color);
+                    connection.color = Get_Opponent_Color(connection.color);
+                }
+                else if (command == "END")
+                {
+                    const auto pawns = connection.othellier.Count_All_Pawns();
+
+                    valid = !connection.othellier.Generate_Legal_Moves(E_Pawn_Color::BLACK) && !connection.othellier.Generate_Legal_Moves(E_Pawn_Color::WHITE)
+                         && argument == std::to_string(pawns.first) && second_argument == std::to_string(pawns.second);
+
+                    ++matches;
+
+                    if (--connection.matches_left > 0)
+                    {
+                        answer += new_game;
+                    }
+                    else
+                    {
+                        connection.done = true;
+                        --connections_left;
+                    }
+                }
+                else
+                {
+                    valid = false;
+                }
+
+                if (!valid)
+                {
+                    std::cerr << "unexpected answer of the server : " << words.str() << std::endl;
+                    ++errors;
+
+                    if (!connection.done)
+                    {
+                        connection.done = true;
+                        --connections_left;
+                    }
+                }
+            }
+
+            connection.input.erase(0, line_start);
+
+            if (!connection.done && !answer.empty()) { Send_Line(connection.descriptor, answer); }
+            if (connection.done) { ::close(connection.descriptor); }
+        }
+    }
+
+    const double elapsed_s{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+    std::cout << number_of_connections << " connections, " << matches << " matches in " << elapsed_s << " s : " << matches / (elapsed_s + 1e-9) << " matches/s, "
+              << errors << " errors" << std::endl;
+    std::cout << round_trips.Get_Count() << " moves, round trip p50 " << round_trips.Get_Percentile_ns(50) / 1000.0 << " us p99 "
+              << round_trips.Get_Percentile_ns(99) / 1000.0 << " us" << std::endl;
+
+    // Statistics of the server, on a connection of their own
+    const int descriptor{Connect_to_Server(address)};
+    std::string statistics;
+
+    if (descriptor >= 0 && Send_Line(descriptor, "STATS\n"))
+    {
+        std::array<char, SERVER_READ_SIZE> buffer;
+        ssize_t count{0};
+
+        while (statistics.find('\n') == std::string::npos && (count = ::read(descriptor, buffer.data(), buffer.size())) > 0) { statistics.append(buffer.data(), static_cast<std::size_t>(count)); }
+    }
+
+    if (descriptor >= 0) { ::close(descriptor); }
+    std::cout << "server : " << statistics;
+
+    ::close(epoll_descriptor);
+
+    return errors > 0 ? 1 : 0;
+} // main
+
+/********************************************************************************************************************************************************************/
+/********************************************************************************************************************************************************************/